@@ -4,18 +4,80 @@
  */
 
 #include <QApplication>
+#include <QDateTime>
 #include <QDebug>
+#include <QElapsedTimer>
+#include <QStringList>
+#include <QTimer>
 #include "MainWindow.h"
+#include "PreferencesPage.h"
+#include "SingleInstance.h"
 
 int main(int argc, char *argv[])
 {
+    QElapsedTimer startupTimer;
+    startupTimer.start();
+    const qint64 launchMs = QDateTime::currentMSecsSinceEpoch();
+
+    // 单实例服务名依赖应用名，需在任何应用对象创建之前设置
+    QCoreApplication::setApplicationName("MultiPageDemo");
+
+    // 已有实例在运行时只交出参数，不创建任何应用对象和界面
+    QStringList arguments;
+    for (int i = 1; i < argc; ++i)
+        arguments << QString::fromLocal8Bit(argv[i]);
+    const mainui::LaunchRequest request = mainui::LaunchRequest::fromArguments(arguments);
+    if (!request.newInstance
+        && mainui::SingleInstance::sendToRunning(request.toArguments(), launchMs)) {
+        qDebug() << "已交给运行中的实例，耗时:" << startupTimer.elapsed() << "ms";
+        return 0;
+    }
+
     QApplication app(argc, argv);
-    app.setApplicationName("MultiPageDemo");
-    
+
     qDebug() << "程序启动...";
 
+    // 在构建界面之前开始监听，缩短两个实例同时启动时都创建窗口的窗口期；
+    // 连接在事件循环开始后才会被处理，届时窗口已经建好
+    mainui::SingleInstance instance;
+    QString error;
+    if (request.newInstance) {
+        qDebug() << "以独立实例运行";
+    } else if (!instance.listen(&error)) {
+        // 探测之后另一个实例抢先开始监听时，改为交给它处理
+        if (mainui::SingleInstance::sendToRunning(request.toArguments(), launchMs)) {
+            qDebug() << "已交给运行中的实例，耗时:" << startupTimer.elapsed() << "ms";
+            return 0;
+        }
+        qWarning() << "单实例服务启动失败:" << error;
+    }
+
+    // 在构建界面之前安装翻译，避免启动后再整体重新翻译一次
+    PreferencesPage::applySavedLanguage();
+
     mainui::MainWindow window;
     window.show();
 
+    QObject::connect(&instance, &mainui::SingleInstance::messageReceived, &window,
+                     [&window](const QStringList &arguments, qint64 clientStartMs) {
+        window.handleLaunchRequest(mainui::LaunchRequest::fromArguments(arguments));
+        // 从另一进程启动到本窗口处理完请求并绘制的总耗时
+        QTimer::singleShot(0, [clientStartMs]() {
+            qDebug() << "转交启动到窗口可用耗时:"
+                     << QDateTime::currentMSecsSinceEpoch() - clientStartMs << "ms";
+        });
+    });
+
+    // 命令行参数在快照恢复之后处理，避免被快照中的路径覆盖
+    QTimer::singleShot(0, [&window, &request]() {
+        if (!request.path.isEmpty() || request.page >= 0)
+            window.handleLaunchRequest(request);
+    });
+
+    // 事件循环处理完首批事件（首帧绘制）时记录启动耗时
+    QTimer::singleShot(0, [&startupTimer]() {
+        qDebug() << "启动到窗口可用耗时:" << startupTimer.elapsed() << "ms";
+    });
+
     return app.exec();
 }
@@ -0,0 +1,73 @@
+/**
+ * @file BatchRenameDialog.h
+ * @brief 批量重命名对话框 - 按模板、序号和正则批量改名或修改属性，支持撤销
+ */
+
+#ifndef BATCHRENAMEDIALOG_H
+#define BATCHRENAMEDIALOG_H
+
+#include <QDialog>
+#include "BatchRenamer.h"
+
+QT_BEGIN_NAMESPACE
+namespace Ui { class BatchRenameDialog; }
+QT_END_NAMESPACE
+
+class QTimer;
+class RenamePreviewModel;
+
+/**
+ * 批量重命名对话框
+ */
+class BatchRenameDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit BatchRenameDialog(QWidget *parent = nullptr);
+    ~BatchRenameDialog();
+
+    // names 为 directory 下的名称，按列表中的显示顺序排列
+    void setFiles(const QString &directory, const QStringList &names);
+    bool isRunning() const { return m_renamer->isRunning(); }
+    // 按上次异常退出留下的恢复日志把名称改回原样
+    void recover(const RenameRecoveryLog &log);
+
+signals:
+    // 执行期间文件列表不必逐项响应，结束后统一刷新一次
+    void batchStarted(const QString &directory);
+    void batchFinished(const QString &directory);
+
+protected:
+    void changeEvent(QEvent *event) override;
+    void showEvent(QShowEvent *event) override;
+
+private slots:
+    void updateRule();
+    void onScanFinished(int changedCount, int conflictCount);
+    void onApplyClicked();
+    void onUndoClicked();
+    void onCancelClicked();
+    void onProgressChanged(int taskId, int done, int total);
+    void onFinished(int taskId, bool success, const QString &message, const RenameJournal &journal);
+
+private:
+    void setBusy(bool busy);
+    void retranslate();           // 语言切换后重新翻译界面
+
+private:
+    Ui::BatchRenameDialog *ui;
+    BatchRenamer *m_renamer;
+    RenamePreviewModel *m_model;
+    QTimer *m_ruleTimer;          // 合并连续输入后再刷新预览
+    QString m_directory;
+    RenameRule m_rule;
+    bool m_ruleValid;
+    int m_taskId;
+    bool m_undoing;
+    RenameJournal m_journal;      // 上一次成功执行的操作，用于撤销
+    QString m_lastResult;         // 执行结果，预览重新检查后一并显示
+    bool m_retranslatePending;    // 隐藏时收到语言切换，下次显示时再翻译
+};
+
+#endif // BATCHRENAMEDIALOG_H
@@ -0,0 +1,149 @@
+/**
+ * @file BatchRenamer.h
+ * @brief 批量重命名与属性修改 - 预先检查冲突，分批执行，失败时按日志回滚
+ */
+
+#ifndef BATCHRENAMER_H
+#define BATCHRENAMER_H
+
+#include <QMetaType>
+#include <QObject>
+#include <QRegularExpression>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <atomic>
+#include <thread>
+
+/**
+ * 重命名规则
+ * 1. 先对原名称（不含扩展名）做查找替换，支持正则和反向引用 \1
+ * 2. 再按模板生成新名称，模板中可用 {name}（替换后的名称）、{ext}（含点的扩展名）、{n}（序号）
+ * 使用前需调用 compile()，之后 apply() 可在任意线程调用
+ */
+class RenameRule
+{
+public:
+    QString pattern = QStringLiteral("{name}{ext}");
+    QString find;
+    QString replace;
+    bool useRegex = false;
+    int counterStart = 1;
+    int counterStep = 1;
+    int counterWidth = 3;
+
+    bool compile(QString *error = nullptr);
+    QString apply(const QString &name, int index) const;
+
+    static bool isValidFileName(const QString &name);
+    // 判断重名用的键：大小写不敏感的文件系统（Windows、macOS）上按折叠后的名称比较
+    static QString nameKey(const QString &name);
+
+private:
+    struct Segment
+    {
+        enum Kind { Literal, Name, Extension, Counter };
+        Kind kind;
+        QString text;
+    };
+
+    QVector<Segment> m_segments;
+    QRegularExpression m_regex;
+};
+
+/**
+ * 撤销日志：记录已完成的操作，按执行顺序排列
+ */
+struct RenameJournal
+{
+    struct Entry
+    {
+        QString from;
+        QString to;                  // 最终名称，只修改属性时与from相同
+        qint64 oldMode = -1;         // 修改前的权限（Unix为st_mode，其他平台为QFile::Permissions），-1表示未修改
+        qint64 oldModifiedNs = -1;   // 修改前的修改时间（纳秒），-1表示未修改
+    };
+
+    QString directory;
+    QVector<Entry> entries;
+
+    bool isEmpty() const { return entries.isEmpty(); }
+};
+
+Q_DECLARE_METATYPE(RenameJournal)
+
+/**
+ * 改名恢复日志
+ * 改名前把全部步骤（含两阶段改名的临时名称）写入磁盘，每批完成后更新进度，
+ * 正常结束或回滚成功后删除。进程中途被终止时，下次启动据此把名称恢复为执行前的状态。
+ * 只记录名称，不包含属性修改。
+ */
+struct RenameRecoveryLog
+{
+    QString directory;
+    QStringList from;       // 按执行顺序排列的每一步
+    QStringList to;
+    int completed = 0;      // 已确认完成的步数，其后最多还有一批可能已完成
+
+    bool isEmpty() const { return from.isEmpty(); }
+
+    // 读取上次未正常结束的日志，没有时返回空日志
+    static RenameRecoveryLog pending();
+    static void discard();
+};
+
+/**
+ * 批量重命名执行器
+ * 所有目标名称在动手前一次算出，用哈希集合检查批内重名和与目录中已有项的冲突，
+ * 有冲突时整批拒绝。目标名称与其他源名称交叉（如 a→b、b→a）时先改为临时名称再改为目标名称。
+ * 每次改名都不覆盖已有项（Linux 用 RENAME_NOREPLACE），检查之后才出现的同名项会使本批失败并回滚。
+ * Unix下通过目录文件描述符调用 renameat/fchmodat/utimensat，每批检查一次取消并报告进度；
+ * 任何一步失败或被取消时按日志逆序回滚已完成的操作；改名步骤同时写入恢复日志，
+ * 进程异常退出后可在下次启动时恢复。
+ * 符号链接只改名，不修改属性（改动会作用到链接目标上）。
+ */
+class BatchRenamer : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum AttributeChange {
+        KeepAttributes,
+        MakeReadOnly,
+        MakeWritable,
+        TouchModified      // 修改时间设为当前时间
+    };
+
+    explicit BatchRenamer(QObject *parent = nullptr);
+    ~BatchRenamer();
+
+    // 返回本次任务的编号，用于丢弃过期结果；names 为 directory 下的名称，顺序决定序号
+    int execute(const QString &directory, const QStringList &names, const RenameRule &rule,
+                AttributeChange change);
+    int undo(const RenameJournal &journal);
+    // 按恢复日志把名称改回执行前的状态，结果同样通过finished送达
+    int recover(const RenameRecoveryLog &log);
+    void cancel();
+    bool isRunning() const { return m_running.load(); }
+
+signals:
+    // 在工作线程中发出，通过队列连接送达
+    void progressChanged(int taskId, int done, int total);
+    // 成功时journal为本次完成的操作；失败或取消时已回滚，journal为空
+    void finished(int taskId, bool success, const QString &message, const RenameJournal &journal);
+
+private:
+    void runExecute(int taskId, const QString &directory, const QStringList &names, RenameRule rule,
+                    AttributeChange change);
+    void runUndo(int taskId, const RenameJournal &journal);
+    void runRecover(int taskId, const RenameRecoveryLog &log);
+    void stopWorker();
+
+private:
+    std::thread m_worker;
+    std::atomic<bool> m_cancelled;
+    std::atomic<bool> m_running;
+    int m_taskId;
+};
+
+#endif // BATCHRENAMER_H
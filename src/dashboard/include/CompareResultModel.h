@@ -0,0 +1,35 @@
+/**
+ * @file CompareResultModel.h
+ * @brief 目录比较结果列表模型
+ */
+
+#ifndef COMPARERESULTMODEL_H
+#define COMPARERESULTMODEL_H
+
+#include <QAbstractListModel>
+#include "DirectoryComparer.h"
+
+/**
+ * 目录比较结果模型
+ * 显示文本按需生成，配合QListView的uniformItemSizes只为可见行取数据，
+ * 几十万条差异也能流畅滚动。
+ */
+class CompareResultModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    explicit CompareResultModel(QObject *parent = nullptr);
+
+    void setEntries(const QVector<CompareEntry> &entries);
+    const QVector<CompareEntry> &entries() const { return m_entries; }
+    const CompareEntry &entry(int row) const { return m_entries.at(row); }
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+private:
+    QVector<CompareEntry> m_entries;
+};
+
+#endif // COMPARERESULTMODEL_H
@@ -0,0 +1,92 @@
+/**
+ * @file ContentSearcher.h
+ * @brief 文件内容搜索 - 并行遍历 + SIMD字面量预筛选 + 正则回退
+ */
+
+#ifndef CONTENTSEARCHER_H
+#define CONTENTSEARCHER_H
+
+#include <QObject>
+#include <QMetaType>
+#include <QRegularExpression>
+#include <QStringList>
+#include <QVector>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * 单条内容匹配结果（每个匹配行一条）
+ */
+struct ContentMatch
+{
+    QString filePath;
+    int lineNumber = 0;
+    QString lineText;
+};
+
+Q_DECLARE_METATYPE(ContentMatch)
+
+/**
+ * 内容搜索器
+ * 一个遍历线程负责枚举文件，多个工作线程通过内存映射读取文件并匹配。
+ * 匹配结果按批次通过信号流式发出，可随时取消。
+ * 匹配总数达到上限时自动停止，结束信号中注明结果被截断。
+ */
+class ContentSearcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit ContentSearcher(QObject *parent = nullptr);
+    ~ContentSearcher();
+
+    // 开始新的搜索（会先取消正在进行的搜索），返回本次搜索的编号
+    int start(const QString &rootPath, const QString &pattern,
+              const QStringList &nameFilters, bool useRegex);
+    void cancel();
+    bool isRunning() const { return m_running.load(); }
+
+signals:
+    // 以下信号均在工作线程中发出，通过队列连接送达接收者
+    void matchesFound(int searchId, const QVector<ContentMatch> &matches);
+    void progressChanged(int searchId, int filesScanned);
+    void finished(int searchId, bool cancelled, bool truncated);
+
+private:
+    void walk(QString rootPath, QStringList nameFilters);
+    void work();
+    void searchFile(const QString &path, QVector<ContentMatch> &out);
+    void searchBuffer(const QString &path, const char *data, qint64 size,
+                      QVector<ContentMatch> &out);
+    void flush(QVector<ContentMatch> &batch);
+    bool reserveMatch();
+    void join();
+
+private:
+    // 搜索参数（搜索开始后只读）
+    QByteArray m_literal;           // 字面量（正则模式下为必需子串，可能为空）
+    bool m_caseSensitive;
+    bool m_useRegex;
+    QRegularExpression m_regex;
+    int m_searchId;
+
+    // 遍历线程 -> 工作线程 的文件队列
+    std::mutex m_queueMutex;
+    std::condition_variable m_queueCond;
+    std::deque<QString> m_queue;
+    bool m_walkDone;
+
+    std::vector<std::thread> m_threads;
+    std::atomic<bool> m_cancelled;
+    std::atomic<bool> m_truncated;      // 达到匹配总数上限后停止
+    std::atomic<int> m_matchCount;
+    std::atomic<bool> m_running;
+    std::atomic<int> m_activeWorkers;
+    std::atomic<int> m_filesScanned;
+};
+
+#endif // CONTENTSEARCHER_H
@@ -0,0 +1,62 @@
+/**
+ * @file DirectoryCompareDialog.h
+ * @brief 目录比较对话框 - 比较两个目录树并把左侧的变化同步到右侧
+ */
+
+#ifndef DIRECTORYCOMPAREDIALOG_H
+#define DIRECTORYCOMPAREDIALOG_H
+
+#include <QDialog>
+#include <QElapsedTimer>
+#include "DirectoryComparer.h"
+
+QT_BEGIN_NAMESPACE
+namespace Ui { class DirectoryCompareDialog; }
+QT_END_NAMESPACE
+
+class CompareResultModel;
+
+/**
+ * 目录比较对话框
+ */
+class DirectoryCompareDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit DirectoryCompareDialog(QWidget *parent = nullptr);
+    ~DirectoryCompareDialog();
+
+    void setLeftPath(const QString &path);
+
+protected:
+    void changeEvent(QEvent *event) override;
+    void showEvent(QShowEvent *event) override;
+
+private slots:
+    void onBrowseLeft();
+    void onBrowseRight();
+    void onCompareClicked();
+    void onSyncClicked();
+    void onCancelClicked();
+    void onProgressChanged(int taskId, const QString &message);
+    void onCompareFinished(int taskId, const QVector<CompareEntry> &entries, qint64 identicalCount);
+    void onSyncFinished(int taskId, int filesWritten, qint64 bytesWritten, int failures);
+
+private:
+    void setBusy(bool busy);
+    void retranslate();           // 语言切换后重新翻译界面
+
+private:
+    Ui::DirectoryCompareDialog *ui;
+    DirectoryComparer *m_comparer;
+    CompareResultModel *m_model;
+    int m_taskId;
+    QString m_comparedLeft;    // 当前结果对应的两侧目录
+    QString m_comparedRight;
+    QElapsedTimer m_timer;
+    QString m_syncSummary;     // 同步后自动重新比较时一并显示
+    bool m_retranslatePending;    // 隐藏时收到语言切换，下次显示时再翻译
+};
+
+#endif // DIRECTORYCOMPAREDIALOG_H
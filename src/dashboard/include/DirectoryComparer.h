@@ -0,0 +1,83 @@
+/**
+ * @file DirectoryComparer.h
+ * @brief 目录比较与同步 - 并行遍历两个目录树，按元数据分类后按块确认差异
+ */
+
+#ifndef DIRECTORYCOMPARER_H
+#define DIRECTORYCOMPARER_H
+
+#include <QMetaType>
+#include <QObject>
+#include <QString>
+#include <QVector>
+#include <atomic>
+#include <thread>
+
+/**
+ * 单个差异项（路径相对于两侧根目录）
+ */
+struct CompareEntry
+{
+    enum Status {
+        OnlyLeft,        // 仅左侧存在（目录只列出最上层）
+        OnlyRight,       // 仅右侧存在
+        Changed,         // 内容不同
+        TimestampOnly,   // 大小相同、内容相同，仅修改时间不同
+        TypeMismatch     // 一侧是文件，另一侧是目录
+    };
+
+    QString relativePath;
+    Status status = Changed;
+    bool isDir = false;
+    qint64 leftSize = -1;
+    qint64 rightSize = -1;
+    int changedBlocks = -1;   // 大小相同时逐块比较的结果，-1表示未逐块比较
+    int totalBlocks = 0;
+};
+
+Q_DECLARE_METATYPE(CompareEntry)
+
+/**
+ * 目录比较器
+ * 1. 两个线程分别遍历左右目录，只读取元数据（大小、修改时间）
+ * 2. 大小与修改时间都相同的文件视为相同，不读内容；大小不同的直接判为已修改
+ * 3. 只有大小相同而时间不同的文件才内存映射后逐块比较，由多个线程并行完成
+ * 同步以左侧为准：复制仅左侧存在的项，大小相同的文件只改写不同的块，其余整体复制；
+ * 不删除仅右侧存在的项。
+ */
+class DirectoryComparer : public QObject
+{
+    Q_OBJECT
+
+public:
+    static const int BlockSize = 64 * 1024;
+
+    explicit DirectoryComparer(QObject *parent = nullptr);
+    ~DirectoryComparer();
+
+    // 返回本次任务的编号，用于丢弃过期结果
+    int compare(const QString &leftRoot, const QString &rightRoot);
+    int sync(const QString &leftRoot, const QString &rightRoot, const QVector<CompareEntry> &entries);
+    void cancel();
+    bool isRunning() const { return m_running.load(); }
+
+signals:
+    // 在工作线程中发出，通过队列连接送达
+    void progressChanged(int taskId, const QString &message);
+    void compareFinished(int taskId, const QVector<CompareEntry> &entries, qint64 identicalCount);
+    void syncFinished(int taskId, int filesWritten, qint64 bytesWritten, int failures);
+
+private:
+    void runCompare(int taskId, const QString &leftRoot, const QString &rightRoot);
+    void runSync(int taskId, const QString &leftRoot, const QString &rightRoot,
+                 const QVector<CompareEntry> &entries);
+    void stopWorker();
+
+private:
+    std::thread m_worker;
+    std::atomic<bool> m_cancelled;
+    std::atomic<bool> m_running;
+    int m_taskId;
+};
+
+#endif // DIRECTORYCOMPARER_H
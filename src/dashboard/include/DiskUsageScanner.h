@@ -0,0 +1,65 @@
+/**
+ * @file DiskUsageScanner.h
+ * @brief 磁盘占用并行扫描器 - 边扫描边填充SizeTree
+ */
+
+#ifndef DISKUSAGESCANNER_H
+#define DISKUSAGESCANNER_H
+
+#include <QObject>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class SizeTree;
+
+/**
+ * 磁盘占用扫描器
+ * 多个工作线程从共享队列中取目录，列出其子项后批量写入SizeTree，
+ * 新发现的子目录再放回队列。界面可在扫描过程中随时读取已聚合的数据。
+ * 只扫描根目录所在的设备，不进入挂载在其下的其他文件系统（/proc、网络盘等）。
+ */
+class DiskUsageScanner : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit DiskUsageScanner(SizeTree *tree, QObject *parent = nullptr);
+    ~DiskUsageScanner();
+
+    void start(const QString &rootPath);
+    void cancel();
+    bool isRunning() const { return m_running.load(); }
+    // 上一次扫描已结束且未被取消，SizeTree中的数据完整
+    bool isComplete() const { return !m_running.load() && !m_cancelled.load(); }
+
+signals:
+    // 在工作线程中发出，通过队列连接送达
+    void progressChanged(int directoriesScanned);
+    void finished(bool cancelled);
+
+private:
+    void work();
+    void join();
+
+private:
+    SizeTree *m_tree;
+
+    std::mutex m_queueMutex;
+    std::condition_variable m_queueCond;
+    std::deque<quint32> m_queue;
+    int m_pending;   // 已入队但尚未处理完的目录数
+    bool m_checkDevice;
+    quint64 m_rootDevice;   // 根目录所在设备（st_dev）
+
+    std::vector<std::thread> m_threads;
+    std::atomic<bool> m_cancelled;
+    std::atomic<bool> m_running;
+    std::atomic<int> m_activeWorkers;
+    std::atomic<int> m_directoriesScanned;
+};
+
+#endif // DISKUSAGESCANNER_H
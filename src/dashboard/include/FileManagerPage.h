@@ -9,6 +9,20 @@
 #include <QWidget>
 #include <QFileSystemModel>
 #include <QSortFilterProxyModel>
+#include "ContentSearcher.h"
+#include "SizeTree.h"
+#include "MetadataService.h"
+#include "FileSortProxyModel.h"
+#include "SessionSnapshot.h"
+
+class QFileInfo;
+class QListWidgetItem;
+class QuickOpenDialog;
+class DirectoryCompareDialog;
+class BatchRenameDialog;
+class DiskUsageScanner;
+class QTimer;
+class QStandardItemModel;
 
 QT_BEGIN_NAMESPACE
 namespace Ui { class FileManagerPage; }
@@ -28,7 +42,22 @@ public:
 
     static QString pageName() { return QObject::tr("文件管理"); }
 
+    // 退出时保存当前路径、列表内容和展开的目录
+    void saveSnapshot(SessionSnapshot *snapshot) const;
+
+    // 打开目录，或跳转到文件所在目录并选中该文件
+    void openPath(const QString &path);
+
+protected:
+    void changeEvent(QEvent *event) override;
+    void showEvent(QShowEvent *event) override;
+
 private slots:
+    void reconcileWithFileSystem();
+    void onDirectoryLoaded(const QString &path);
+    void showLiveModel();
+    void onTreeExpanded(const QModelIndex &index);
+    void onTreeCollapsed(const QModelIndex &index);
     void onTreeClicked(const QModelIndex &index);
     void onListClicked(const QModelIndex &index);
     void onPathEditReturn();
@@ -38,17 +67,83 @@ private slots:
     void onSearchTextChanged(const QString &text);
     void onFilterChanged(int index);
 
+    // 内容搜索
+    void onContentSearchToggled(bool checked);
+    void onSearchReturnPressed();
+    void onContentMatchesFound(int searchId, const QVector<ContentMatch> &matches);
+    void onContentSearchProgress(int searchId, int filesScanned);
+    void onContentSearchFinished(int searchId, bool cancelled, bool truncated);
+    void onSearchResultActivated(QListWidgetItem *item);
+
+    // 快速打开
+    void onQuickOpenClicked();
+    void onQuickOpenPathChosen(const QString &path);
+
+    // 占用分析
+    void onTreemapToggled(bool checked);
+    void onTreemapNodeActivated(quint32 node);
+    void onDiskScanProgress(int directoriesScanned);
+    void onDiskScanFinished(bool cancelled);
+
+    // 目录比较
+    void onCompareClicked();
+
+    // 批量重命名
+    void onRenameClicked();
+    void onBatchStarted(const QString &directory);
+    void onBatchFinished(const QString &directory);
+
+    // 元数据与排序
+    void onMetadataReady(const QString &path, const FileMetadata &meta);
+    void onSortChanged();
+    void onChecksumToggled(bool checked);
+
 private:
     void setupFileSystem();
+    void showSnapshot(const SessionSnapshot &snapshot);
+    QString filePathForListIndex(const QModelIndex &index) const;
     void updateCurrentPath(const QString &path);
+    void revealFile(const QString &path);
+    void showFileInfo(const QFileInfo &info);
     QString getSelectedFilePath() const;
     QString formatFileSize(qint64 size) const;
+    QStringList currentNameFilters() const;
+    void updateContentView();
+    void prefetchMetadata();
+    void showMetadata(const FileMetadata &meta);
+    QStringList filterLabels() const;
+    BatchRenameDialog *renameDialog();
+    bool offerRenameRecovery();
+    void retranslate();
 
 private:
     Ui::FileManagerPage *ui;
     QFileSystemModel *m_fileModel;
-    QSortFilterProxyModel *m_proxyModel;
+    MetadataService *m_metadataService;
+    FileSortProxyModel *m_proxyModel;
+    QTimer *m_resortTimer;               // 合并元数据到达后的重新排序
     QString m_currentPath;
+    QString m_selectedPath;
+
+    // 启动快照：文件系统模型就绪前先显示上次的列表
+    QStandardItemModel *m_snapshotModel;
+    bool m_showingSnapshot;
+    QStringList m_expandedPaths;
+
+    ContentSearcher *m_contentSearcher;
+    int m_contentSearchId;
+    int m_contentMatchCount;
+
+    QuickOpenDialog *m_quickOpenDialog;  // 首次使用时创建
+
+    SizeTree m_sizeTree;
+    DiskUsageScanner *m_diskScanner;
+    QTimer *m_treemapRefreshTimer;       // 扫描期间定时刷新树图
+
+    DirectoryCompareDialog *m_compareDialog;  // 首次使用时创建
+    BatchRenameDialog *m_renameDialog;        // 首次使用时创建
+
+    bool m_retranslatePending;           // 隐藏时收到语言切换，下次显示时再翻译
 };
 
 #endif // FILEMANAGERPAGE_H
@@ -0,0 +1,49 @@
+/**
+ * @file FileSortProxyModel.h
+ * @brief 文件列表排序代理 - 支持按元数据缓存中的字段排序
+ */
+
+#ifndef FILESORTPROXYMODEL_H
+#define FILESORTPROXYMODEL_H
+
+#include <QSortFilterProxyModel>
+
+class QFileInfo;
+class MetadataService;
+
+/**
+ * 文件列表排序代理
+ * 目录始终排在文件之前；按元数据排序时只读缓存，尚未提取或不适用的文件视为最小值。
+ */
+class FileSortProxyModel : public QSortFilterProxyModel
+{
+    Q_OBJECT
+
+public:
+    enum SortKey {
+        SortByName,
+        SortBySize,
+        SortByModified,
+        SortByDimensions,   // 以下依赖元数据缓存
+        SortByLineCount,
+        SortByDuration
+    };
+
+    explicit FileSortProxyModel(MetadataService *metadata, QObject *parent = nullptr);
+
+    void setSortKey(SortKey key);
+    SortKey sortKey() const { return m_sortKey; }
+    bool sortKeyNeedsMetadata() const { return m_sortKey >= SortByDimensions; }
+
+protected:
+    bool lessThan(const QModelIndex &left, const QModelIndex &right) const override;
+
+private:
+    double metadataKey(const QFileInfo &info) const;
+
+private:
+    MetadataService *m_metadata;
+    SortKey m_sortKey;
+};
+
+#endif // FILESORTPROXYMODEL_H
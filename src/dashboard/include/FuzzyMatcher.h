@@ -0,0 +1,55 @@
+/**
+ * @file FuzzyMatcher.h
+ * @brief 路径模糊匹配器 - 位掩码预筛选 + 子序列计分 + Top-K
+ */
+
+#ifndef FUZZYMATCHER_H
+#define FUZZYMATCHER_H
+
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <string>
+#include <vector>
+
+/**
+ * 模糊匹配器
+ * 路径以UTF-8连续存放在一个字符串池中，每条路径附带一个字符位掩码。
+ * 新查询是上一次查询的延伸时，只在上一次的命中集合中继续筛选。
+ */
+class FuzzyMatcher
+{
+public:
+    struct Match
+    {
+        quint32 index;
+        int score;
+    };
+
+    FuzzyMatcher();
+
+    void clear();
+    void addPaths(const QStringList &paths);
+    int size() const { return int(m_masks.size()); }
+    QString path(quint32 index) const;
+
+    // 返回得分最高的limit条结果（按得分降序）
+    QVector<Match> match(const QString &query, int limit);
+
+private:
+    static quint64 charMask(const char *s, int len);
+    static bool score(const char *s, int len, const QByteArray &query, int *result);
+
+private:
+    std::string m_pool;               // 所有路径的UTF-8字节
+    std::vector<quint32> m_offsets;   // 每条路径在池中的起始位置（末尾多存一个结束位置）
+    std::vector<quint64> m_masks;     // 每条路径包含的字符集合
+
+    // 增量匹配状态
+    QByteArray m_lastQuery;
+    std::vector<quint32> m_survivors; // 上一次查询命中的路径
+    quint32 m_scannedCount;           // 上一次查询覆盖到的路径数量
+};
+
+#endif // FUZZYMATCHER_H
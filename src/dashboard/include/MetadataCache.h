@@ -0,0 +1,76 @@
+/**
+ * @file MetadataCache.h
+ * @brief 文件元数据及其持久化缓存
+ */
+
+#ifndef METADATACACHE_H
+#define METADATACACHE_H
+
+#include <QDataStream>
+#include <QHash>
+#include <QMetaType>
+#include <QString>
+#include <mutex>
+
+/**
+ * 单个文件的扩展元数据
+ * size/modified用于判断缓存是否仍然有效
+ */
+struct FileMetadata
+{
+    qint64 size = -1;
+    qint64 modified = 0;        // 修改时间（毫秒时间戳）
+
+    // 图片
+    int width = 0;
+    int height = 0;
+    QString cameraModel;        // EXIF Make + Model
+    QString dateTaken;          // EXIF DateTimeOriginal
+
+    // 音频
+    double durationSeconds = 0.0;
+
+    // 文本
+    QString textEncoding;
+    qint64 lineCount = -1;
+
+    // 可选校验和（SHA-256，十六进制）
+    QString checksum;
+
+    bool isValid() const { return size >= 0; }
+};
+
+Q_DECLARE_METATYPE(FileMetadata)
+
+QDataStream &operator<<(QDataStream &out, const FileMetadata &meta);
+QDataStream &operator>>(QDataStream &in, FileMetadata &meta);
+
+/**
+ * 元数据持久化缓存
+ * 以文件路径为键，大小或修改时间变化即视为失效。
+ * 首次访问时才从缓存文件加载（不拖慢启动），析构时写回；所有接口线程安全。
+ */
+class MetadataCache
+{
+public:
+    explicit MetadataCache(const QString &filePath);
+    ~MetadataCache();
+
+    // 查找与给定大小/修改时间一致的记录
+    bool lookup(const QString &path, qint64 size, qint64 modified, FileMetadata *meta) const;
+    void insert(const QString &path, const FileMetadata &meta);
+
+    bool save();
+
+private:
+    void ensureLoaded() const;
+
+private:
+    mutable std::mutex m_mutex;
+    QString m_filePath;
+    mutable QHash<QString, FileMetadata> m_entries;
+    mutable bool m_loaded;
+    bool m_dirty;
+};
+
+#endif // METADATACACHE_H
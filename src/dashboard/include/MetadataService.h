@@ -0,0 +1,92 @@
+/**
+ * @file MetadataService.h
+ * @brief 后台元数据提取服务 - 按优先级只读取所需的文件头
+ */
+
+#ifndef METADATASERVICE_H
+#define METADATASERVICE_H
+
+#include <QObject>
+#include <QHash>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+#include "MetadataCache.h"
+
+class QFile;
+class QFileInfo;
+
+/**
+ * 元数据提取服务
+ * 选中的文件以高优先级插队，当前目录的其余文件以低优先级预取；
+ * 结果写入持久化缓存，未变化的文件不会重复提取。
+ */
+class MetadataService : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Priority {
+        LowPriority = 0,     // 目录预取（用于排序）
+        HighPriority = 1     // 当前选中
+    };
+
+    explicit MetadataService(QObject *parent = nullptr);
+    ~MetadataService();
+
+    // 命中缓存时直接返回true并填充meta，否则加入提取队列
+    bool request(const QFileInfo &info, Priority priority, bool withChecksum, FileMetadata *meta);
+
+    // 只查缓存，不触发提取
+    bool cached(const QFileInfo &info, FileMetadata *meta) const;
+
+    // 丢弃尚未开始的低优先级任务（切换目录时调用）
+    void clearPrefetch();
+
+signals:
+    // 在工作线程中发出
+    void metadataReady(const QString &path, const FileMetadata &meta);
+
+private:
+    struct Task
+    {
+        int priority;
+        quint64 sequence;
+        QString path;
+        bool withChecksum;
+
+        bool operator<(const Task &other) const
+        {
+            // 优先级高者先出队，同优先级按请求顺序
+            if (priority != other.priority)
+                return priority < other.priority;
+            return sequence > other.sequence;
+        }
+    };
+
+    void work();
+    FileMetadata extract(const QString &path, bool withChecksum) const;
+
+    static void readImageHeader(QFile &file, const QByteArray &header, FileMetadata *meta);
+    static void readJpeg(QFile &file, FileMetadata *meta);
+    static void readExif(const QByteArray &tiff, FileMetadata *meta);
+    static void readWavHeader(const QByteArray &header, FileMetadata *meta);
+    static void readText(QFile &file, const QByteArray &header, FileMetadata *meta);
+
+private:
+    MetadataCache m_cache;
+
+    std::mutex m_queueMutex;
+    std::condition_variable m_queueCond;
+    std::priority_queue<Task> m_queue;
+    QHash<QString, int> m_queued;   // 已排队路径 -> 最高优先级，用于去重
+    quint64 m_sequence;
+
+    std::vector<std::thread> m_threads;
+    std::atomic<bool> m_stopping;
+};
+
+#endif // METADATASERVICE_H
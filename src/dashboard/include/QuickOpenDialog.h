@@ -0,0 +1,73 @@
+/**
+ * @file QuickOpenDialog.h
+ * @brief 快速打开对话框 - 对根目录下所有路径做模糊匹配（Ctrl+P）
+ */
+
+#ifndef QUICKOPENDIALOG_H
+#define QUICKOPENDIALOG_H
+
+#include <QDialog>
+#include <atomic>
+#include <thread>
+#include "FuzzyMatcher.h"
+
+QT_BEGIN_NAMESPACE
+namespace Ui { class QuickOpenDialog; }
+QT_END_NAMESPACE
+
+class QListWidgetItem;
+
+/**
+ * 快速打开对话框
+ * 后台线程索引根目录下的全部路径，输入时增量地缩小候选集合并排序
+ */
+class QuickOpenDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit QuickOpenDialog(QWidget *parent = nullptr);
+    ~QuickOpenDialog();
+
+    // 根目录改变时重新建立索引
+    void setRootPath(const QString &rootPath);
+
+signals:
+    void pathChosen(const QString &path);
+
+    // 索引线程 -> 界面线程
+    void pathsIndexed(int generation, const QStringList &paths);
+    void indexFinished(int generation);
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+    void changeEvent(QEvent *event) override;
+    void showEvent(QShowEvent *event) override;
+
+private slots:
+    void onQueryChanged(const QString &text);
+    void onPathsIndexed(int generation, const QStringList &paths);
+    void onIndexFinished(int generation);
+    void onItemActivated(QListWidgetItem *item);
+
+private:
+    void startIndexing();
+    void stopIndexing();
+    void refreshResults();
+    void updateStatus();
+    void retranslate();           // 语言切换后重新翻译界面
+
+private:
+    Ui::QuickOpenDialog *ui;
+    FuzzyMatcher m_matcher;
+    QString m_rootPath;
+
+    std::thread m_indexThread;
+    std::atomic<bool> m_indexCancelled;
+    int m_indexGeneration;
+    bool m_indexing;
+    double m_lastMatchMs;
+    bool m_retranslatePending;    // 隐藏时收到语言切换，下次显示时再翻译
+};
+
+#endif // QUICKOPENDIALOG_H
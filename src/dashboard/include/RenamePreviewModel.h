@@ -0,0 +1,65 @@
+/**
+ * @file RenamePreviewModel.h
+ * @brief 批量重命名预览模型
+ */
+
+#ifndef RENAMEPREVIEWMODEL_H
+#define RENAMEPREVIEWMODEL_H
+
+#include <QAbstractListModel>
+#include <QHash>
+#include <QStringList>
+#include <QVector>
+#include "BatchRenamer.h"
+
+class QTimer;
+
+/**
+ * 重命名预览模型
+ * 新名称在data()中按需计算，配合uniformItemSizes只为可见行生成文字；
+ * 批内重名检查由定时器分段完成，每段处理固定行数，十万级选择也不会阻塞界面。
+ * 检查完成后一次性刷新冲突标记，并发出scanFinished。
+ */
+class RenamePreviewModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    explicit RenamePreviewModel(QObject *parent = nullptr);
+
+    void setFiles(const QStringList &names);
+    void setRule(const RenameRule &rule);   // rule 需已编译
+    const QStringList &names() const { return m_names; }
+    bool isScanning() const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+signals:
+    void scanFinished(int changedCount, int conflictCount);
+
+private slots:
+    void scanChunk();
+
+private:
+    void restartScan();
+
+private:
+    enum RowFlag : quint8 {
+        Unchecked = 0,
+        Checked   = 1,
+        Conflict  = 2,
+        Invalid   = 4
+    };
+
+    QStringList m_names;
+    RenameRule m_rule;
+    QVector<quint8> m_flags;
+    QHash<QString, int> m_seen;     // 目标名称（RenameRule::nameKey）-> 首次出现的行
+    QTimer *m_scanTimer;
+    int m_scanRow;
+    int m_changedCount;
+    int m_conflictCount;
+};
+
+#endif // RENAMEPREVIEWMODEL_H
@@ -0,0 +1,48 @@
+/**
+ * @file SessionSnapshot.h
+ * @brief 启动快照 - 退出时保存界面状态，启动时先显示快照再与文件系统核对
+ */
+
+#ifndef SESSIONSNAPSHOT_H
+#define SESSIONSNAPSHOT_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/**
+ * 快照中的一个列表项
+ */
+struct SnapshotEntry
+{
+    QString name;
+    bool isDir = false;
+    qint64 size = 0;
+    qint64 modified = 0;   // 毫秒时间戳
+};
+
+/**
+ * 会话快照
+ * 包含最后路径、当前列表内容、树中展开的节点和当前导航页
+ */
+class SessionSnapshot
+{
+public:
+    // 首次调用时从磁盘加载，之后返回同一份数据
+    static SessionSnapshot &current();
+
+    bool isValid() const { return !lastPath.isEmpty(); }
+    bool save() const;
+
+public:
+    QString lastPath;
+    QVector<SnapshotEntry> entries;
+    QStringList expandedPaths;
+    int navPage = 0;
+
+private:
+    static QString filePath();
+    void load();
+};
+
+#endif // SESSIONSNAPSHOT_H
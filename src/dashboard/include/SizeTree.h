@@ -0,0 +1,95 @@
+/**
+ * @file SizeTree.h
+ * @brief 磁盘占用聚合树 - 紧凑节点 + 分块arena分配
+ */
+
+#ifndef SIZETREE_H
+#define SIZETREE_H
+
+#include <QString>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * 磁盘占用聚合树
+ * 节点按块分配在arena中，编号即下标；名称存放在分块的字符池中。
+ * 扫描线程通过addChildren()追加数据，界面线程可同时读取，内部用互斥锁保护。
+ */
+class SizeTree
+{
+public:
+    static const quint32 InvalidNode = 0xFFFFFFFFu;
+
+    struct Entry
+    {
+        QString name;
+        quint64 size;
+        bool isDir;
+    };
+
+    struct Child
+    {
+        quint32 node;
+        quint64 size;
+        bool isDir;
+    };
+
+    SizeTree();
+    ~SizeTree();
+
+    // 清空并以rootPath作为0号根节点
+    void reset(const QString &rootPath);
+    QString rootPath() const;
+    bool isEmpty() const;
+
+    // 追加一个目录的全部子项并向上累加文件大小，返回新建的子目录节点
+    std::vector<quint32> addChildren(quint32 dir, const std::vector<Entry> &entries);
+
+    // 读取接口（线程安全）
+    std::vector<Child> children(quint32 node) const;  // 按大小降序
+    quint64 size(quint32 node) const;
+    bool isDir(quint32 node) const;
+    quint32 parent(quint32 node) const;
+    QString name(quint32 node) const;
+    QString path(quint32 node) const;
+    quint32 find(const QString &path) const;
+    void countChildren(quint32 node, int *dirs, int *files) const;
+
+    quint32 nodeCount() const;
+    quint64 memoryUsage() const;
+
+private:
+    // 32字节的紧凑节点
+    struct Node
+    {
+        quint64 size;
+        quint32 parent;
+        quint32 firstChild;
+        quint32 nextSibling;
+        quint32 nameOffset;
+        quint16 nameLength;
+        quint16 flags;
+    };
+
+    enum NodeFlag { DirFlag = 0x1 };
+
+    Node &node(quint32 index);
+    const Node &node(quint32 index) const;
+    quint32 allocNode();
+    quint32 storeName(const QByteArray &utf8);
+    QString nameLocked(quint32 index) const;
+    QString pathLocked(quint32 index) const;
+
+private:
+    mutable std::mutex m_mutex;
+    QString m_rootPath;
+
+    std::vector<std::unique_ptr<Node[]>> m_nodeBlocks;
+    quint32 m_nodeCount;
+
+    std::vector<std::unique_ptr<char[]>> m_nameBlocks;
+    quint32 m_nameUsed;   // 已使用的名称字节（跨块的全局偏移）
+};
+
+#endif // SIZETREE_H
@@ -0,0 +1,64 @@
+/**
+ * @file TreemapWidget.h
+ * @brief 磁盘占用矩形树图 - 只为可见层级计算布局
+ */
+
+#ifndef TREEMAPWIDGET_H
+#define TREEMAPWIDGET_H
+
+#include <QWidget>
+#include <vector>
+#include "SizeTree.h"
+
+/**
+ * 矩形树图控件
+ * 以squarified算法布局当前根节点下若干层的子项，
+ * 数据来自扫描中的SizeTree，调用invalidateLayout()即可刷新。
+ */
+class TreemapWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit TreemapWidget(QWidget *parent = nullptr);
+
+    void setTree(const SizeTree *tree);
+    void setRootNode(quint32 node);
+    quint32 rootNode() const { return m_rootNode; }
+
+    // 数据有变化时调用，下次绘制时重新布局
+    void invalidateLayout();
+
+signals:
+    // 左键点击：跳转到该目录（文件则为其所在目录）；右键：返回上一层
+    void nodeActivated(quint32 node);
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+
+private:
+    struct Tile
+    {
+        QRectF rect;
+        quint32 node;
+        int depth;
+        bool isDir;
+    };
+
+    void layoutTiles();
+    void layoutChildren(quint32 node, const QRectF &rect, int depth);
+    void squarify(const std::vector<SizeTree::Child> &items, QRectF rect, int depth);
+    void placeTile(const SizeTree::Child &item, const QRectF &rect, int depth);
+    int tileAt(const QPointF &pos) const;
+
+private:
+    const SizeTree *m_tree;
+    quint32 m_rootNode;
+    std::vector<Tile> m_tiles;
+    bool m_layoutDirty;
+};
+
+#endif // TREEMAPWIDGET_H
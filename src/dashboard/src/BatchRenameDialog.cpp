@@ -0,0 +1,279 @@
+/**
+ * @file BatchRenameDialog.cpp
+ * @brief 批量重命名对话框实现
+ */
+
+#include "BatchRenameDialog.h"
+#include "ui_BatchRenameDialog.h"
+#include "RenamePreviewModel.h"
+#include <QDir>
+#include <QEvent>
+#include <QHash>
+#include <QMessageBox>
+#include <QShowEvent>
+#include <QSignalBlocker>
+#include <QTimer>
+
+namespace {
+
+const int kRuleDelayMs = 150;
+
+} // namespace
+
+BatchRenameDialog::BatchRenameDialog(QWidget *parent)
+    : QDialog(parent)
+    , ui(new Ui::BatchRenameDialog())
+    , m_renamer(new BatchRenamer(this))
+    , m_model(new RenamePreviewModel(this))
+    , m_ruleTimer(new QTimer(this))
+    , m_ruleValid(false)
+    , m_taskId(0)
+    , m_undoing(false)
+    , m_retranslatePending(false)
+{
+    ui->setupUi(this);
+    ui->previewView->setModel(m_model);
+
+    m_ruleTimer->setSingleShot(true);
+    m_ruleTimer->setInterval(kRuleDelayMs);
+    connect(m_ruleTimer, &QTimer::timeout, this, &BatchRenameDialog::updateRule);
+
+    auto scheduleRule = [this]() { m_ruleTimer->start(); };
+    connect(ui->patternEdit, &QLineEdit::textChanged, this, scheduleRule);
+    connect(ui->findEdit, &QLineEdit::textChanged, this, scheduleRule);
+    connect(ui->replaceEdit, &QLineEdit::textChanged, this, scheduleRule);
+    connect(ui->regexCheck, &QCheckBox::toggled, this, scheduleRule);
+    connect(ui->counterStartSpin, QOverload<int>::of(&QSpinBox::valueChanged), this, scheduleRule);
+    connect(ui->counterStepSpin, QOverload<int>::of(&QSpinBox::valueChanged), this, scheduleRule);
+    connect(ui->counterWidthSpin, QOverload<int>::of(&QSpinBox::valueChanged), this, scheduleRule);
+    connect(ui->attributeCombo, QOverload<int>::of(&QComboBox::currentIndexChanged), this, scheduleRule);
+
+    connect(ui->applyButton, &QPushButton::clicked, this, &BatchRenameDialog::onApplyClicked);
+    connect(ui->undoButton, &QPushButton::clicked, this, &BatchRenameDialog::onUndoClicked);
+    connect(ui->cancelButton, &QPushButton::clicked, this, &BatchRenameDialog::onCancelClicked);
+
+    connect(m_model, &RenamePreviewModel::scanFinished, this, &BatchRenameDialog::onScanFinished);
+    connect(m_renamer, &BatchRenamer::progressChanged, this, &BatchRenameDialog::onProgressChanged);
+    connect(m_renamer, &BatchRenamer::finished, this, &BatchRenameDialog::onFinished);
+
+    updateRule();
+}
+
+BatchRenameDialog::~BatchRenameDialog()
+{
+    delete ui;
+}
+
+void BatchRenameDialog::changeEvent(QEvent *event)
+{
+    if (event->type() == QEvent::LanguageChange) {
+        // 对话框隐藏时只做标记
+        if (isVisible())
+            retranslate();
+        else
+            m_retranslatePending = true;
+    }
+    QDialog::changeEvent(event);
+}
+
+void BatchRenameDialog::showEvent(QShowEvent *event)
+{
+    if (m_retranslatePending) {
+        m_retranslatePending = false;
+        retranslate();
+    }
+    QDialog::showEvent(event);
+}
+
+void BatchRenameDialog::retranslate()
+{
+    // 状态栏显示的是运行结果，翻译后保留
+    const QString status = ui->statusLabel->text();
+    ui->retranslateUi(this);
+    ui->statusLabel->setText(status);
+    // 预览文字由模型提供，重绘后即为新语言
+    ui->previewView->viewport()->update();
+}
+
+void BatchRenameDialog::setFiles(const QString &directory, const QStringList &names)
+{
+    if (m_renamer->isRunning())
+        return;
+
+    m_directory = QDir::cleanPath(directory);
+    ui->applyButton->setEnabled(false);
+    m_model->setFiles(names);
+    ui->statusLabel->setText(tr("已选择 %1 项，正在检查重名...").arg(names.size()));
+}
+
+void BatchRenameDialog::updateRule()
+{
+    RenameRule rule;
+    rule.pattern = ui->patternEdit->text();
+    rule.find = ui->findEdit->text();
+    rule.replace = ui->replaceEdit->text();
+    rule.useRegex = ui->regexCheck->isChecked();
+    rule.counterStart = ui->counterStartSpin->value();
+    rule.counterStep = ui->counterStepSpin->value();
+    rule.counterWidth = ui->counterWidthSpin->value();
+
+    ui->applyButton->setEnabled(false);
+    QString error;
+    m_ruleValid = rule.compile(&error);
+    if (!m_ruleValid) {
+        ui->statusLabel->setText(error);
+        return;
+    }
+
+    m_rule = rule;
+    m_model->setRule(rule);
+    if (!m_model->names().isEmpty())
+        ui->statusLabel->setText(tr("正在检查重名..."));
+}
+
+void BatchRenameDialog::onScanFinished(int changedCount, int conflictCount)
+{
+    const int total = m_model->rowCount();
+    const bool changesAttributes = ui->attributeCombo->currentIndex() != BatchRenamer::KeepAttributes;
+    ui->applyButton->setEnabled(m_ruleValid && !m_renamer->isRunning() && conflictCount == 0
+                                && (changedCount > 0 || (changesAttributes && total > 0)));
+
+    QString summary;
+    if (total == 0)
+        summary = tr("在文件列表中选择文件后设置规则");
+    else if (conflictCount > 0)
+        summary = tr("共 %1 项，其中 %2 项重名或名称无效（红色标出）").arg(total).arg(conflictCount);
+    else
+        summary = tr("共 %1 项，将重命名 %2 项").arg(total).arg(changedCount);
+    ui->statusLabel->setText(m_lastResult.isEmpty() ? summary : m_lastResult + tr("；") + summary);
+    m_lastResult.clear();
+}
+
+void BatchRenameDialog::onApplyClicked()
+{
+    const int total = m_model->rowCount();
+    const QMessageBox::StandardButton answer = QMessageBox::question(
+        this, tr("批量重命名"),
+        tr("将处理 %1 下的 %2 项。\n执行前会检查与目录中已有文件的冲突，失败时自动回滚。是否继续？")
+            .arg(QDir::toNativeSeparators(m_directory))
+            .arg(total));
+    if (answer != QMessageBox::Yes)
+        return;
+
+    m_undoing = false;
+    setBusy(true);
+    emit batchStarted(m_directory);
+    m_taskId = m_renamer->execute(m_directory, m_model->names(), m_rule,
+                                  static_cast<BatchRenamer::AttributeChange>(ui->attributeCombo->currentIndex()));
+    ui->statusLabel->setText(tr("正在处理..."));
+}
+
+void BatchRenameDialog::onUndoClicked()
+{
+    if (m_journal.isEmpty())
+        return;
+
+    const QMessageBox::StandardButton answer = QMessageBox::question(
+        this, tr("撤销"),
+        tr("将恢复上次处理的 %1 项的名称和属性。是否继续？").arg(m_journal.entries.size()));
+    if (answer != QMessageBox::Yes)
+        return;
+
+    m_undoing = true;
+    setBusy(true);
+    emit batchStarted(m_journal.directory);
+    m_taskId = m_renamer->undo(m_journal);
+    ui->statusLabel->setText(tr("正在撤销..."));
+}
+
+void BatchRenameDialog::recover(const RenameRecoveryLog &log)
+{
+    if (m_renamer->isRunning() || log.isEmpty())
+        return;
+
+    m_directory = QDir::cleanPath(log.directory);
+    m_undoing = false;
+    setBusy(true);
+    emit batchStarted(m_directory);
+    m_taskId = m_renamer->recover(log);
+    ui->statusLabel->setText(tr("正在按恢复日志恢复 %1 ...").arg(QDir::toNativeSeparators(m_directory)));
+}
+
+void BatchRenameDialog::onCancelClicked()
+{
+    // 工作线程会回滚已完成的部分，结果仍通过finished送达
+    m_renamer->cancel();
+    ui->cancelButton->setEnabled(false);
+    ui->statusLabel->setText(tr("正在取消并回滚..."));
+}
+
+void BatchRenameDialog::onProgressChanged(int taskId, int done, int total)
+{
+    if (taskId == m_taskId && m_renamer->isRunning())
+        ui->statusLabel->setText(tr("正在处理... %1 / %2").arg(done).arg(total));
+}
+
+void BatchRenameDialog::onFinished(int taskId, bool success, const QString &message,
+                                   const RenameJournal &journal)
+{
+    if (taskId != m_taskId)
+        return;
+
+    const QString directory = m_undoing ? m_journal.directory : m_directory;
+    if (success) {
+        // 预览中的名称换成当前磁盘上的名称
+        QHash<QString, QString> renamed;
+        const RenameJournal &applied = m_undoing ? m_journal : journal;
+        renamed.reserve(applied.entries.size());
+        for (const RenameJournal::Entry &entry : applied.entries) {
+            if (m_undoing)
+                renamed.insert(entry.to, entry.from);
+            else
+                renamed.insert(entry.from, entry.to);
+        }
+        if (applied.directory == m_directory) {
+            QStringList names = m_model->names();
+            for (QString &name : names)
+                name = renamed.value(name, name);
+            m_model->setFiles(names);
+        }
+
+        m_journal = m_undoing ? RenameJournal() : journal;
+        if (!m_undoing) {
+            // 规则已生效，恢复默认，避免再次执行时重复套用；预览由下面的setBusy统一刷新
+            const QSignalBlocker patternBlocker(ui->patternEdit);
+            const QSignalBlocker findBlocker(ui->findEdit);
+            const QSignalBlocker replaceBlocker(ui->replaceEdit);
+            const QSignalBlocker attributeBlocker(ui->attributeCombo);
+            ui->patternEdit->setText(QStringLiteral("{name}{ext}"));
+            ui->findEdit->clear();
+            ui->replaceEdit->clear();
+            ui->attributeCombo->setCurrentIndex(BatchRenamer::KeepAttributes);
+        }
+    }
+
+    // 预览重新检查后会覆盖状态栏，结果与检查摘要一并显示
+    m_lastResult = message;
+    setBusy(false);
+    ui->statusLabel->setText(message);
+    emit batchFinished(directory);
+}
+
+void BatchRenameDialog::setBusy(bool busy)
+{
+    ui->applyButton->setEnabled(false);
+    ui->undoButton->setEnabled(!busy && !m_journal.isEmpty());
+    ui->cancelButton->setEnabled(busy);
+    ui->patternEdit->setEnabled(!busy);
+    ui->findEdit->setEnabled(!busy);
+    ui->replaceEdit->setEnabled(!busy);
+    ui->regexCheck->setEnabled(!busy);
+    ui->counterStartSpin->setEnabled(!busy);
+    ui->counterStepSpin->setEnabled(!busy);
+    ui->counterWidthSpin->setEnabled(!busy);
+    ui->attributeCombo->setEnabled(!busy);
+
+    // 预览检查完成时会重新决定是否允许执行
+    if (!busy)
+        updateRule();
+}
@@ -0,0 +1,862 @@
+/**
+ * @file BatchRenamer.cpp
+ * @brief 批量重命名与属性修改实现
+ */
+
+#include "BatchRenamer.h"
+#include <QDataStream>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QRandomGenerator>
+#include <QSaveFile>
+#include <QSet>
+#include <QStandardPaths>
+#include <cerrno>
+#include <cstdio>
+#include <functional>
+
+#ifdef Q_OS_UNIX
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const int kBatchSize = 1024;            // 每批操作后检查一次取消并报告进度
+const int kMaxReportedConflicts = 5;
+const quint32 kRecoveryMagic = 0x524E4A4C;   // "RNJL"
+const quint32 kRecoveryVersion = 1;
+
+struct RenamePair
+{
+    QString from;
+    QString to;
+};
+
+/**
+ * 目录句柄：Unix下打开一次目录，之后所有操作都相对于该描述符，
+ * 不再逐个解析完整路径；其他平台退回到Qt的文件接口
+ */
+class DirectoryHandle
+{
+public:
+    explicit DirectoryHandle(const QString &path)
+        : m_path(path)
+#ifdef Q_OS_UNIX
+        , m_fd(::open(QFile::encodeName(path).constData(), O_RDONLY | O_DIRECTORY | O_CLOEXEC))
+#endif
+    {
+    }
+
+    ~DirectoryHandle()
+    {
+#ifdef Q_OS_UNIX
+        if (m_fd >= 0)
+            ::close(m_fd);
+#endif
+    }
+
+    const QString &path() const { return m_path; }
+
+    // 不跟随符号链接，悬空的链接也算存在
+    bool exists(const QString &name)
+    {
+        qint64 mode = 0;
+        qint64 modifiedNs = 0;
+        bool isLink = false;
+        return readAttributes(name, &mode, &modifiedNs, &isLink);
+    }
+
+    bool isOpen() const
+    {
+#ifdef Q_OS_UNIX
+        return m_fd >= 0;
+#else
+        return QFileInfo(m_path).isDir();
+#endif
+    }
+
+    // 目标已存在时失败（EEXIST），不会覆盖检查之后才出现的项
+    bool rename(const QString &from, const QString &to)
+    {
+#ifdef Q_OS_UNIX
+        const QByteArray source = QFile::encodeName(from);
+        const QByteArray target = QFile::encodeName(to);
+#if defined(Q_OS_LINUX) && defined(RENAME_NOREPLACE)
+        if (::renameat2(m_fd, source.constData(), m_fd, target.constData(), RENAME_NOREPLACE) == 0)
+            return true;
+        if (errno != EINVAL && errno != ENOSYS)
+            return false;
+        // 文件系统不支持 RENAME_NOREPLACE，退回到下面的方式
+#elif defined(Q_OS_DARWIN)
+        if (::renameatx_np(m_fd, source.constData(), m_fd, target.constData(), RENAME_EXCL) == 0)
+            return true;
+        if (errno != ENOTSUP && errno != EINVAL)
+            return false;
+#endif
+        // 文件用硬链接+删除原名完成，linkat 在目标存在时同样失败
+        if (::linkat(m_fd, source.constData(), m_fd, target.constData(), 0) == 0) {
+            if (::unlinkat(m_fd, source.constData(), 0) == 0)
+                return true;
+            const int savedErrno = errno;
+            ::unlinkat(m_fd, target.constData(), 0);
+            errno = savedErrno;
+            return false;
+        }
+        if (errno == EEXIST)
+            return false;
+        // 目录和不支持硬链接的文件系统只能先检查再改名
+        struct stat st;
+        if (::fstatat(m_fd, target.constData(), &st, AT_SYMLINK_NOFOLLOW) == 0) {
+            errno = EEXIST;
+            return false;
+        }
+        return ::renameat(m_fd, source.constData(), m_fd, target.constData()) == 0;
+#else
+        // QDir::rename 在目标存在时失败
+        return QDir(m_path).rename(from, to);
+#endif
+    }
+
+    // 读取项本身的属性；isLink 返回是否为符号链接，
+    // 写属性的接口会跟随链接作用到链接目标，调用方需跳过符号链接
+    bool readAttributes(const QString &name, qint64 *mode, qint64 *modifiedNs, bool *isLink)
+    {
+#ifdef Q_OS_UNIX
+        struct stat st;
+        if (::fstatat(m_fd, QFile::encodeName(name).constData(), &st, AT_SYMLINK_NOFOLLOW) != 0)
+            return false;
+        *isLink = S_ISLNK(st.st_mode);
+        *mode = st.st_mode & 07777;
+#ifdef Q_OS_DARWIN
+        *modifiedNs = qint64(st.st_mtimespec.tv_sec) * 1000000000 + st.st_mtimespec.tv_nsec;
+#else
+        *modifiedNs = qint64(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+#endif
+        return true;
+#else
+        const QFileInfo info(QDir(m_path).filePath(name));
+        if (!info.exists() && !info.isSymLink())
+            return false;
+        *isLink = info.isSymLink();
+        *mode = qint64(info.permissions());
+        *modifiedNs = info.lastModified().toMSecsSinceEpoch() * 1000000;
+        return true;
+#endif
+    }
+
+    bool setMode(const QString &name, qint64 mode)
+    {
+#ifdef Q_OS_UNIX
+        return ::fchmodat(m_fd, QFile::encodeName(name).constData(), mode_t(mode), 0) == 0;
+#else
+        return QFile::setPermissions(QDir(m_path).filePath(name), QFile::Permissions(int(mode)));
+#endif
+    }
+
+    // modifiedNs 为 -1 时设为当前时间
+    bool setModified(const QString &name, qint64 modifiedNs)
+    {
+#ifdef Q_OS_UNIX
+        struct timespec times[2];
+        times[0].tv_sec = 0;
+        times[0].tv_nsec = UTIME_OMIT;
+        if (modifiedNs < 0) {
+            times[1].tv_sec = 0;
+            times[1].tv_nsec = UTIME_NOW;
+        } else {
+            times[1].tv_sec = time_t(modifiedNs / 1000000000);
+            times[1].tv_nsec = long(modifiedNs % 1000000000);
+        }
+        return ::utimensat(m_fd, QFile::encodeName(name).constData(), times, 0) == 0;
+#else
+        QFile file(QDir(m_path).filePath(name));
+        const QDateTime time = modifiedNs < 0 ? QDateTime::currentDateTime()
+                                              : QDateTime::fromMSecsSinceEpoch(modifiedNs / 1000000);
+        return file.open(QIODevice::Append) && file.setFileTime(time, QFileDevice::FileModificationTime);
+#endif
+    }
+
+    static qint64 writableMode(qint64 mode, bool writable)
+    {
+#ifdef Q_OS_UNIX
+        return writable ? (mode | S_IWUSR) : (mode & ~qint64(S_IWUSR | S_IWGRP | S_IWOTH));
+#else
+        const qint64 writeBits = QFile::WriteOwner | QFile::WriteUser | QFile::WriteGroup | QFile::WriteOther;
+        return writable ? (mode | QFile::WriteOwner | QFile::WriteUser) : (mode & ~writeBits);
+#endif
+    }
+
+private:
+    QString m_path;
+#ifdef Q_OS_UNIX
+    int m_fd;
+#endif
+};
+
+/**
+ * 动手前的冲突检查：目标名称不能重复，也不能与目录中不参与改名的已有项相同
+ * crossing 返回是否有目标名称恰好是另一项的源名称，此时需要两阶段改名
+ */
+bool checkConflicts(const QString &directory, const QVector<RenamePair> &pairs, bool *crossing,
+                    QString *error)
+{
+    QSet<QString> sources;
+    sources.reserve(pairs.size());
+    for (const RenamePair &pair : pairs)
+        sources.insert(RenameRule::nameKey(pair.from));
+
+    QSet<QString> existing;
+    const QStringList entries = QDir(directory).entryList(QDir::AllEntries | QDir::NoDotAndDotDot
+                                                          | QDir::Hidden | QDir::System);
+    existing.reserve(entries.size());
+    for (const QString &entry : entries)
+        existing.insert(RenameRule::nameKey(entry));
+
+    QSet<QString> targets;
+    targets.reserve(pairs.size());
+    QStringList conflicts;
+    int conflictCount = 0;
+    *crossing = false;
+    for (const RenamePair &pair : pairs) {
+        const QString key = RenameRule::nameKey(pair.to);
+        bool conflict = false;
+        if (targets.contains(key)) {
+            conflict = true;
+        } else {
+            targets.insert(key);
+            if (sources.contains(key))
+                *crossing = true;
+            else if (existing.contains(key))
+                conflict = true;
+        }
+        if (conflict && ++conflictCount <= kMaxReportedConflicts)
+            conflicts << pair.from + QStringLiteral(" → ") + pair.to;
+    }
+
+    if (conflictCount == 0)
+        return true;
+    if (error) {
+        *error = QObject::tr("%1 个目标名称与其他项重复，未做任何改动: %2%3")
+                     .arg(conflictCount)
+                     .arg(conflicts.join(QStringLiteral("; ")))
+                     .arg(conflictCount > kMaxReportedConflicts ? QStringLiteral(" ...") : QString());
+    }
+    return false;
+}
+
+QString recoveryLogPath()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation) + "/rename.journal";
+}
+
+// 进度单独存放，每批只需重写几个字节
+QString recoveryProgressPath()
+{
+    return recoveryLogPath() + ".progress";
+}
+
+bool writeRecoveryProgress(int completed)
+{
+    QSaveFile file(recoveryProgressPath());
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_0);
+    out << kRecoveryMagic << qint32(completed);
+    return file.commit();
+}
+
+bool writeRecoveryLog(const QString &directory, const QVector<RenamePair> &steps)
+{
+    const QString path = recoveryLogPath();
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    // 先清零进度，再写步骤，避免新日志配上旧进度
+    if (!writeRecoveryProgress(0))
+        return false;
+
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_0);
+    out << kRecoveryMagic << kRecoveryVersion << directory << quint32(steps.size());
+    for (const RenamePair &step : steps)
+        out << step.from << step.to;
+    return file.commit();
+}
+
+void removeRecoveryLog()
+{
+    QFile::remove(recoveryLogPath());
+    QFile::remove(recoveryProgressPath());
+}
+
+/**
+ * 执行一组改名，完成的每一步都追加到done，供失败时回滚
+ * 有交叉时先全部改为临时名称，再改为目标名称
+ */
+bool renameAll(DirectoryHandle &dir, const QVector<RenamePair> &pairs, bool crossing,
+               const std::function<bool()> &step, QVector<RenamePair> *done, QString *error)
+{
+    QVector<RenamePair> plan;
+    if (crossing) {
+        // 临时名称带随机部分，不会与上次中断遗留的临时文件同名；即使同名，改名也不会覆盖
+        const QString prefix = QStringLiteral(".~rename-%1-")
+                                   .arg(QRandomGenerator::global()->generate64(), 16, 16, QLatin1Char('0'));
+        QVector<RenamePair> second;
+        plan.reserve(pairs.size());
+        second.reserve(pairs.size());
+        for (int i = 0; i < pairs.size(); ++i) {
+            const QString temp = prefix + QString::number(i);
+            plan.append({ pairs[i].from, temp });
+            second.append({ temp, pairs[i].to });
+        }
+        plan += second;
+    }
+    const QVector<RenamePair> &steps = crossing ? plan : pairs;
+    if (steps.isEmpty())
+        return true;
+
+    // 上次未恢复的日志不能被覆盖，否则那批文件的原名称就丢失了
+    if (QFile::exists(recoveryLogPath())) {
+        if (error)
+            *error = QObject::tr("上次的批量重命名没有正常结束，请先恢复或丢弃它的记录");
+        return false;
+    }
+
+    // 动手前写入恢复日志，进程中途退出时下次启动仍能找回原名称
+    if (!writeRecoveryLog(dir.path(), steps)) {
+        if (error)
+            *error = QObject::tr("无法写入恢复日志: %1").arg(QDir::toNativeSeparators(recoveryLogPath()));
+        return false;
+    }
+
+    done->reserve(steps.size());
+    for (const RenamePair &pair : steps) {
+        if (!dir.rename(pair.from, pair.to)) {
+            const QString reason = qt_error_string();
+            if (error)
+                *error = QObject::tr("无法重命名 %1: %2").arg(pair.from, reason);
+            // 一步都没有完成时日志已无用；否则由调用方回滚后删除
+            if (done->isEmpty())
+                removeRecoveryLog();
+            return false;
+        }
+        done->append(pair);
+        if (done->size() % kBatchSize == 0 && !writeRecoveryProgress(done->size())) {
+            if (error)
+                *error = QObject::tr("无法更新恢复日志: %1").arg(QDir::toNativeSeparators(recoveryProgressPath()));
+            return false;
+        }
+        if (!step())
+            return false;
+    }
+    return true;
+}
+
+// 逆序撤销已完成的改名，返回失败的步数
+int rollbackRenames(DirectoryHandle &dir, const QVector<RenamePair> &done)
+{
+    int failures = 0;
+    for (int i = done.size() - 1; i >= 0; --i) {
+        if (!dir.rename(done[i].to, done[i].from)) {
+            qWarning() << "回滚失败:" << done[i].to << "->" << done[i].from << qt_error_string();
+            ++failures;
+        }
+    }
+    return failures;
+}
+
+} // namespace
+
+bool RenameRule::compile(QString *error)
+{
+    // 模板预先拆成片段，apply 时不再解析
+    m_segments.clear();
+    const QString text = pattern.isEmpty() ? QStringLiteral("{name}{ext}") : pattern;
+    QString literal;
+    for (int i = 0; i < text.size(); ++i) {
+        Segment::Kind kind = Segment::Literal;
+        int length = 0;
+        if (text.at(i) == '{') {
+            if (text.mid(i, 6) == QLatin1String("{name}")) {
+                kind = Segment::Name;
+                length = 6;
+            } else if (text.mid(i, 5) == QLatin1String("{ext}")) {
+                kind = Segment::Extension;
+                length = 5;
+            } else if (text.mid(i, 3) == QLatin1String("{n}")) {
+                kind = Segment::Counter;
+                length = 3;
+            }
+        }
+        if (kind == Segment::Literal) {
+            literal += text.at(i);
+            continue;
+        }
+        if (!literal.isEmpty()) {
+            m_segments.append({ Segment::Literal, literal });
+            literal.clear();
+        }
+        m_segments.append({ kind, QString() });
+        i += length - 1;
+    }
+    if (!literal.isEmpty())
+        m_segments.append({ Segment::Literal, literal });
+
+    m_regex = QRegularExpression();
+    if (useRegex && !find.isEmpty()) {
+        m_regex.setPattern(find);
+        if (!m_regex.isValid()) {
+            if (error)
+                *error = QObject::tr("正则表达式无效: %1").arg(m_regex.errorString());
+            return false;
+        }
+        m_regex.optimize();
+    }
+    return true;
+}
+
+QString RenameRule::apply(const QString &name, int index) const
+{
+    // 扩展名取最后一个点之后的部分；以点开头的隐藏文件视为没有扩展名
+    const int dot = name.lastIndexOf('.');
+    QString base = dot > 0 ? name.left(dot) : name;
+    const QString extension = dot > 0 ? name.mid(dot) : QString();
+
+    if (!find.isEmpty()) {
+        if (useRegex)
+            base.replace(m_regex, replace);
+        else
+            base.replace(find, replace);
+    }
+
+    QString result;
+    result.reserve(name.size() + 8);
+    for (const Segment &segment : m_segments) {
+        switch (segment.kind) {
+        case Segment::Literal:
+            result += segment.text;
+            break;
+        case Segment::Name:
+            result += base;
+            break;
+        case Segment::Extension:
+            result += extension;
+            break;
+        case Segment::Counter:
+            result += QString::number(qint64(counterStart) + qint64(index) * counterStep)
+                          .rightJustified(counterWidth, '0');
+            break;
+        }
+    }
+    return result;
+}
+
+QString RenameRule::nameKey(const QString &name)
+{
+#if defined(Q_OS_WIN) || defined(Q_OS_DARWIN)
+    return name.toCaseFolded();
+#else
+    return name;
+#endif
+}
+
+bool RenameRule::isValidFileName(const QString &name)
+{
+    if (name.isEmpty() || name == QLatin1String(".") || name == QLatin1String(".."))
+        return false;
+#ifdef Q_OS_WIN
+    static const QString forbidden = QStringLiteral("\\/:*?\"<>|");
+#else
+    static const QString forbidden = QStringLiteral("/");
+#endif
+    for (const QChar c : name) {
+        if (c.unicode() == 0 || forbidden.contains(c))
+            return false;
+    }
+    return true;
+}
+
+RenameRecoveryLog RenameRecoveryLog::pending()
+{
+    RenameRecoveryLog log;
+    QFile file(recoveryLogPath());
+    if (!file.open(QIODevice::ReadOnly))
+        return log;
+
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_0);
+    quint32 magic = 0;
+    quint32 version = 0;
+    quint32 count = 0;
+    in >> magic >> version;
+    if (magic != kRecoveryMagic || version != kRecoveryVersion) {
+        qWarning() << "无法识别的改名恢复日志:" << recoveryLogPath();
+        return log;
+    }
+    in >> log.directory >> count;
+    for (quint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i) {
+        QString from;
+        QString to;
+        in >> from >> to;
+        log.from << from;
+        log.to << to;
+    }
+    if (in.status() != QDataStream::Ok) {
+        // 步骤写入完整后才会提交，损坏说明文件被改动过，不据此改名
+        qWarning() << "改名恢复日志已损坏:" << recoveryLogPath();
+        return RenameRecoveryLog();
+    }
+
+    QFile progressFile(recoveryProgressPath());
+    if (progressFile.open(QIODevice::ReadOnly)) {
+        QDataStream progress(&progressFile);
+        progress.setVersion(QDataStream::Qt_5_0);
+        qint32 completed = 0;
+        progress >> magic >> completed;
+        if (progress.status() == QDataStream::Ok && magic == kRecoveryMagic)
+            log.completed = qBound(0, int(completed), log.from.size());
+    }
+    return log;
+}
+
+void RenameRecoveryLog::discard()
+{
+    removeRecoveryLog();
+}
+
+BatchRenamer::BatchRenamer(QObject *parent)
+    : QObject(parent)
+    , m_cancelled(false)
+    , m_running(false)
+    , m_taskId(0)
+{
+    qRegisterMetaType<RenameJournal>("RenameJournal");
+}
+
+BatchRenamer::~BatchRenamer()
+{
+    stopWorker();
+}
+
+void BatchRenamer::cancel()
+{
+    m_cancelled = true;
+}
+
+void BatchRenamer::stopWorker()
+{
+    m_cancelled = true;
+    if (m_worker.joinable())
+        m_worker.join();
+    m_cancelled = false;
+}
+
+int BatchRenamer::execute(const QString &directory, const QStringList &names, const RenameRule &rule,
+                          AttributeChange change)
+{
+    stopWorker();
+    const int taskId = ++m_taskId;
+    m_running = true;
+    m_worker = std::thread(&BatchRenamer::runExecute, this, taskId, QDir::cleanPath(directory),
+                           names, rule, change);
+    return taskId;
+}
+
+int BatchRenamer::undo(const RenameJournal &journal)
+{
+    stopWorker();
+    const int taskId = ++m_taskId;
+    m_running = true;
+    m_worker = std::thread(&BatchRenamer::runUndo, this, taskId, journal);
+    return taskId;
+}
+
+int BatchRenamer::recover(const RenameRecoveryLog &log)
+{
+    stopWorker();
+    const int taskId = ++m_taskId;
+    m_running = true;
+    m_worker = std::thread(&BatchRenamer::runRecover, this, taskId, log);
+    return taskId;
+}
+
+void BatchRenamer::runExecute(int taskId, const QString &directory, const QStringList &names,
+                              RenameRule rule, AttributeChange change)
+{
+    QElapsedTimer timer;
+    timer.start();
+    RenameJournal journal;
+    journal.directory = directory;
+
+    auto fail = [&](const QString &message) {
+        m_running = false;
+        emit finished(taskId, false, message, RenameJournal());
+    };
+
+    // 1. 一次算出所有目标名称；规则在本线程重新编译，不与界面线程共享正则对象
+    QString error;
+    if (!rule.compile(&error))
+        return fail(error);
+
+    QStringList targets;
+    targets.reserve(names.size());
+    QVector<RenamePair> pairs;
+    for (int i = 0; i < names.size(); ++i) {
+        const QString target = rule.apply(names[i], i);
+        if (!RenameRule::isValidFileName(target))
+            return fail(tr("无效的名称: %1 → %2").arg(names[i], target));
+        targets << target;
+        if (target != names[i])
+            pairs.append({ names[i], target });
+    }
+
+    // 2. 动手前检查冲突
+    bool crossing = false;
+    if (!checkConflicts(directory, pairs, &crossing, &error))
+        return fail(error);
+
+    DirectoryHandle dir(directory);
+    if (!dir.isOpen())
+        return fail(tr("无法打开目录: %1").arg(QDir::toNativeSeparators(directory)));
+
+    // 3. 分批执行，每批检查一次取消
+    const int total = pairs.size() * (crossing ? 2 : 1)
+                      + (change == KeepAttributes ? 0 : names.size());
+    int completed = 0;
+    const std::function<bool()> step = [&]() {
+        if (++completed % kBatchSize != 0)
+            return true;
+        emit progressChanged(taskId, completed, total);
+        return !m_cancelled.load();
+    };
+
+    QVector<RenamePair> renamed;
+    bool ok = renameAll(dir, pairs, crossing, step, &renamed, &error);
+
+    // 4. 修改属性，记录原值供撤销
+    QVector<qint64> oldModes(names.size(), -1);
+    QVector<qint64> oldTimes(names.size(), -1);
+    int attributesChanged = 0;
+    int skippedLinks = 0;
+    for (int i = 0; ok && change != KeepAttributes && i < targets.size(); ++i) {
+        qint64 mode = 0;
+        qint64 modifiedNs = 0;
+        bool isLink = false;
+        if (!dir.readAttributes(targets[i], &mode, &modifiedNs, &isLink)) {
+            const QString reason = qt_error_string();
+            error = tr("无法读取属性 %1: %2").arg(targets[i], reason);
+            ok = false;
+            break;
+        }
+        if (isLink) {
+            // 链接本身的权限和时间无法可靠修改，改动会落到目标上（可能在目录之外）
+            ++skippedLinks;
+            attributesChanged = i + 1;
+            ok = step();
+            continue;
+        }
+        bool changed = true;
+        if (change == TouchModified) {
+            oldTimes[i] = modifiedNs;
+            changed = dir.setModified(targets[i], -1);
+        } else {
+            const qint64 newMode = DirectoryHandle::writableMode(mode, change == MakeWritable);
+            if (newMode != mode) {
+                oldModes[i] = mode;
+                changed = dir.setMode(targets[i], newMode);
+            }
+        }
+        if (!changed) {
+            const QString reason = qt_error_string();
+            error = tr("无法修改属性 %1: %2").arg(targets[i], reason);
+            oldModes[i] = -1;
+            oldTimes[i] = -1;
+            ok = false;
+            break;
+        }
+        attributesChanged = i + 1;
+        ok = step();
+    }
+
+    if (!ok) {
+        // 先恢复属性再恢复名称，整批回到执行前的状态
+        int failures = 0;
+        for (int i = attributesChanged - 1; i >= 0; --i) {
+            if (oldModes[i] >= 0 && !dir.setMode(targets[i], oldModes[i]))
+                ++failures;
+            if (oldTimes[i] >= 0 && !dir.setModified(targets[i], oldTimes[i]))
+                ++failures;
+        }
+        failures += rollbackRenames(dir, renamed);
+        if (failures == 0 && !renamed.isEmpty())
+            removeRecoveryLog();
+
+        QString message = m_cancelled.load() ? tr("已取消，已回滚 %1 步操作").arg(renamed.size() + attributesChanged)
+                                             : tr("%1，已回滚").arg(error);
+        if (failures > 0)
+            message += tr("（%1 步回滚失败，详见日志）").arg(failures);
+        return fail(message);
+    }
+
+    if (!renamed.isEmpty())
+        removeRecoveryLog();
+
+    // 5. 生成撤销日志
+    journal.entries.reserve(names.size());
+    for (int i = 0; i < names.size(); ++i) {
+        if (names[i] == targets[i] && oldModes[i] < 0 && oldTimes[i] < 0)
+            continue;
+        RenameJournal::Entry entry;
+        entry.from = names[i];
+        entry.to = targets[i];
+        entry.oldMode = oldModes[i];
+        entry.oldModifiedNs = oldTimes[i];
+        journal.entries.append(entry);
+    }
+
+    QString message = tr("完成: 重命名 %1 项，修改属性 %2 项，用时 %3 秒")
+                          .arg(pairs.size())
+                          .arg(change == KeepAttributes ? 0 : names.size() - skippedLinks)
+                          .arg(timer.elapsed() / 1000.0, 0, 'f', 2);
+    if (skippedLinks > 0)
+        message += tr("（跳过 %1 个符号链接的属性修改）").arg(skippedLinks);
+
+    m_running = false;
+    emit finished(taskId, true, message, journal);
+}
+
+void BatchRenamer::runUndo(int taskId, const RenameJournal &journal)
+{
+    auto fail = [&](const QString &message) {
+        m_running = false;
+        emit finished(taskId, false, message, RenameJournal());
+    };
+
+    QVector<RenamePair> pairs;
+    for (const RenameJournal::Entry &entry : journal.entries) {
+        if (entry.from != entry.to)
+            pairs.append({ entry.to, entry.from });
+    }
+
+    QString error;
+    bool crossing = false;
+    if (!checkConflicts(journal.directory, pairs, &crossing, &error))
+        return fail(error);
+
+    DirectoryHandle dir(journal.directory);
+    if (!dir.isOpen())
+        return fail(tr("无法打开目录: %1").arg(QDir::toNativeSeparators(journal.directory)));
+
+    const int total = pairs.size() * (crossing ? 2 : 1) + journal.entries.size();
+    int completed = 0;
+    const std::function<bool()> step = [&]() {
+        if (++completed % kBatchSize != 0)
+            return true;
+        emit progressChanged(taskId, completed, total);
+        return !m_cancelled.load();
+    };
+
+    // 名称整批恢复，失败时回滚到撤销前
+    QVector<RenamePair> renamed;
+    if (!renameAll(dir, pairs, crossing, step, &renamed, &error)) {
+        const int failures = rollbackRenames(dir, renamed);
+        if (failures == 0 && !renamed.isEmpty())
+            removeRecoveryLog();
+        QString message = m_cancelled.load() ? tr("撤销已取消") : tr("撤销失败: %1").arg(error);
+        if (failures > 0)
+            message += tr("（%1 步回滚失败，详见日志）").arg(failures);
+        return fail(message);
+    }
+
+    if (!renamed.isEmpty())
+        removeRecoveryLog();
+
+    // 名称已恢复，属性逐项恢复，失败的只计数；
+    // 执行后被替换成符号链接的项不恢复，避免把原值写到链接目标上
+    // 取消时名称保持已恢复的状态，剩余的属性不再恢复
+    int attributeFailures = 0;
+    int attributesSkipped = 0;
+    bool cancelled = false;
+    for (const RenameJournal::Entry &entry : journal.entries) {
+        const bool hasAttributes = entry.oldMode >= 0 || entry.oldModifiedNs >= 0;
+        if (cancelled) {
+            attributesSkipped += hasAttributes ? 1 : 0;
+            continue;
+        }
+        if (hasAttributes) {
+            qint64 mode = 0;
+            qint64 modifiedNs = 0;
+            bool isLink = false;
+            if (!dir.readAttributes(entry.from, &mode, &modifiedNs, &isLink) || isLink) {
+                ++attributeFailures;
+            } else {
+                if (entry.oldMode >= 0 && !dir.setMode(entry.from, entry.oldMode))
+                    ++attributeFailures;
+                if (entry.oldModifiedNs >= 0 && !dir.setModified(entry.from, entry.oldModifiedNs))
+                    ++attributeFailures;
+            }
+        }
+        cancelled = !step();
+    }
+
+    QString message = tr("已撤销 %1 项").arg(journal.entries.size());
+    if (cancelled)
+        message = tr("已取消：名称已恢复，%1 项属性未恢复").arg(attributesSkipped);
+    if (attributeFailures > 0)
+        message += tr("，%1 项属性未能恢复").arg(attributeFailures);
+
+    m_running = false;
+    emit finished(taskId, true, message, RenameJournal());
+}
+
+void BatchRenamer::runRecover(int taskId, const RenameRecoveryLog &log)
+{
+    DirectoryHandle dir(log.directory);
+    if (!dir.isOpen()) {
+        m_running = false;
+        emit finished(taskId, false, tr("无法打开目录: %1").arg(QDir::toNativeSeparators(log.directory)),
+                      RenameJournal());
+        return;
+    }
+
+    // 进度之后最多还有一批已完成；逆序检查，目标在而源不在的步骤才是已完成的，改回源名称
+    const int last = qMin(log.from.size(), log.completed + kBatchSize);
+    int restored = 0;
+    int failures = 0;
+    for (int i = last - 1; i >= 0; --i) {
+        if (m_cancelled.load())
+            break;
+        if (!dir.exists(log.to[i]) || dir.exists(log.from[i]))
+            continue;
+        if (dir.rename(log.to[i], log.from[i])) {
+            ++restored;
+        } else {
+            qWarning() << "恢复失败:" << log.to[i] << "->" << log.from[i] << qt_error_string();
+            ++failures;
+        }
+    }
+
+    const bool ok = failures == 0 && !m_cancelled.load();
+    if (ok)
+        removeRecoveryLog();
+
+    QString message;
+    if (m_cancelled.load())
+        message = tr("恢复已取消，已恢复 %1 步，下次启动时可继续").arg(restored);
+    else if (failures > 0)
+        message = tr("已恢复 %1 步，%2 步失败（详见日志），下次启动时可重试").arg(restored).arg(failures);
+    else
+        message = tr("已按恢复日志恢复 %1 步改名").arg(restored);
+
+    m_running = false;
+    emit finished(taskId, ok, message, RenameJournal());
+}
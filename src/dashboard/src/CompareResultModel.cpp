@@ -0,0 +1,81 @@
+/**
+ * @file CompareResultModel.cpp
+ * @brief 目录比较结果列表模型实现
+ */
+
+#include "CompareResultModel.h"
+#include <QBrush>
+#include <QColor>
+
+namespace {
+
+QString formatSize(qint64 size)
+{
+    const char *units[] = { "B", "KB", "MB", "GB", "TB" };
+    int unitIndex = 0;
+    double value = double(size);
+    while (value >= 1024.0 && unitIndex < 4) {
+        value /= 1024.0;
+        ++unitIndex;
+    }
+    return QString("%1 %2").arg(value, 0, 'f', 2).arg(units[unitIndex]);
+}
+
+} // namespace
+
+CompareResultModel::CompareResultModel(QObject *parent)
+    : QAbstractListModel(parent)
+{
+}
+
+void CompareResultModel::setEntries(const QVector<CompareEntry> &entries)
+{
+    beginResetModel();
+    m_entries = entries;
+    endResetModel();
+}
+
+int CompareResultModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_entries.size();
+}
+
+QVariant CompareResultModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_entries.size())
+        return QVariant();
+
+    const CompareEntry &entry = m_entries.at(index.row());
+    const QString path = entry.isDir ? entry.relativePath + '/' : entry.relativePath;
+
+    if (role == Qt::DisplayRole) {
+        switch (entry.status) {
+        case CompareEntry::OnlyLeft:
+            return tr("＋ 仅左侧    %1").arg(path);
+        case CompareEntry::OnlyRight:
+            return tr("－ 仅右侧    %1").arg(path);
+        case CompareEntry::TypeMismatch:
+            return tr("⚠ 类型不同    %1").arg(path);
+        case CompareEntry::TimestampOnly:
+            return tr("＝ 仅时间不同    %1").arg(path);
+        case CompareEntry::Changed:
+            if (entry.changedBlocks > 0) {
+                return tr("≠ 已修改    %1    (%2 / %3 块不同)")
+                    .arg(path).arg(entry.changedBlocks).arg(entry.totalBlocks);
+            }
+            return tr("≠ 已修改    %1    (%2 → %3)")
+                .arg(path, formatSize(entry.leftSize), formatSize(entry.rightSize));
+        }
+    } else if (role == Qt::ForegroundRole) {
+        switch (entry.status) {
+        case CompareEntry::OnlyLeft:      return QBrush(QColor("#27ae60"));
+        case CompareEntry::OnlyRight:     return QBrush(QColor("#c0392b"));
+        case CompareEntry::TypeMismatch:  return QBrush(QColor("#d35400"));
+        case CompareEntry::TimestampOnly: return QBrush(QColor("#7f8c8d"));
+        case CompareEntry::Changed:       return QBrush(QColor("#2980b9"));
+        }
+    } else if (role == Qt::ToolTipRole) {
+        return entry.relativePath;
+    }
+    return QVariant();
+}
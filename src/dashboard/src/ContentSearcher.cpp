@@ -0,0 +1,431 @@
+/**
+ * @file ContentSearcher.cpp
+ * @brief 文件内容搜索实现
+ */
+
+#include "ContentSearcher.h"
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QtAlgorithms>
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CONTENTSEARCH_USE_SSE2
+#endif
+
+namespace {
+
+const qint64 kBinaryProbeBytes = 8192;     // 探测二进制文件时检查的头部字节数
+const qint64 kMapThreshold = 64 * 1024;    // 小于该大小的文件直接读取，更大的文件使用内存映射
+const int kMaxMatchesPerFile = 1000;       // 单个文件最多报告的匹配行数
+const int kMaxTotalMatches = 5000;         // 一次搜索最多报告的匹配行数，超出后停止搜索
+const int kMaxLineLength = 300;            // 结果中保留的行文本长度
+const int kMatchBatchSize = 64;            // 每批发出的匹配数
+const size_t kWalkBatchSize = 256;         // 遍历线程每次入队的文件数
+
+inline bool isAsciiAlpha(unsigned char c)
+{
+    c |= 0x20;
+    return c >= 'a' && c <= 'z';
+}
+
+// 只转换ASCII字母，避免破坏UTF-8多字节序列
+QByteArray asciiLower(QByteArray bytes)
+{
+    for (int i = 0; i < bytes.size(); ++i) {
+        const unsigned char c = static_cast<unsigned char>(bytes[i]);
+        if (c >= 'A' && c <= 'Z')
+            bytes[i] = static_cast<char>(c | 0x20);
+    }
+    return bytes;
+}
+
+// 不区分大小写时needle已转为小写
+inline bool equalsAt(const char *p, const QByteArray &needle, bool caseSensitive)
+{
+    if (caseSensitive)
+        return std::memcmp(p, needle.constData(), size_t(needle.size())) == 0;
+
+    for (int i = 0; i < needle.size(); ++i) {
+        const unsigned char a = static_cast<unsigned char>(p[i]);
+        const unsigned char b = static_cast<unsigned char>(needle[i]);
+        if (a != b && !(isAsciiAlpha(a) && (a | 0x20) == b))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * 在[hay, end)中查找needle
+ * SSE2路径同时比较needle的首字节和尾字节，每次筛选16个候选位置，
+ * 只有两端都命中的位置才做完整比较。
+ */
+const char *findLiteral(const char *hay, const char *end, const QByteArray &needle, bool caseSensitive)
+{
+    const qint64 n = needle.size();
+    if (n == 0 || end - hay < n)
+        return nullptr;
+
+    const unsigned char first = static_cast<unsigned char>(needle[0]);
+    const unsigned char last = static_cast<unsigned char>(needle[int(n - 1)]);
+    const unsigned char foldFirst = (!caseSensitive && isAsciiAlpha(first)) ? 0x20 : 0;
+    const unsigned char foldLast = (!caseSensitive && isAsciiAlpha(last)) ? 0x20 : 0;
+
+    const char *p = hay;
+    const char *limit = end - n;  // 最后一个可能的起始位置
+
+#ifdef CONTENTSEARCH_USE_SSE2
+    const __m128i vFirst = _mm_set1_epi8(static_cast<char>(first));
+    const __m128i vLast = _mm_set1_epi8(static_cast<char>(last));
+    const __m128i vFoldFirst = _mm_set1_epi8(static_cast<char>(foldFirst));
+    const __m128i vFoldLast = _mm_set1_epi8(static_cast<char>(foldLast));
+
+    while (limit - p >= 16) {
+        const __m128i blockFirst = _mm_or_si128(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)), vFoldFirst);
+        const __m128i blockLast = _mm_or_si128(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + n - 1)), vFoldLast);
+        quint32 mask = static_cast<quint32>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(blockFirst, vFirst), _mm_cmpeq_epi8(blockLast, vLast))));
+
+        while (mask) {
+            const char *candidate = p + qCountTrailingZeroBits(mask);
+            if (equalsAt(candidate, needle, caseSensitive))
+                return candidate;
+            mask &= mask - 1;
+        }
+        p += 16;
+    }
+#endif
+
+    for (; p <= limit; ++p) {
+        if ((static_cast<unsigned char>(p[0]) | foldFirst) == first
+            && (static_cast<unsigned char>(p[n - 1]) | foldLast) == last
+            && equalsAt(p, needle, caseSensitive)) {
+            return p;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * 从正则表达式中提取每个匹配都必须包含的最长字面量，用作预筛选
+ * 含分支(|)的表达式无法保证，返回空
+ */
+QString requiredLiteral(const QString &pattern)
+{
+    if (pattern.contains('|'))
+        return QString();
+
+    QString best;
+    QString run;
+    int depth = 0;
+
+    auto endRun = [&]() {
+        if (run.size() > best.size())
+            best = run;
+        run.clear();
+    };
+
+    for (int i = 0; i < pattern.size(); ++i) {
+        const QChar c = pattern.at(i);
+        if (c == '\\') {
+            endRun();
+            ++i;  // 跳过转义字符
+        } else if (c == '[') {
+            endRun();
+            while (i < pattern.size() && pattern.at(i) != ']')
+                ++i;
+        } else if (c == '(') {
+            endRun();
+            ++depth;
+        } else if (c == ')') {
+            endRun();
+            depth = qMax(0, depth - 1);
+        } else if (c == '*' || c == '?' || c == '{') {
+            // 量词作用于前一个字符，它不是必需的；{m,n} 中的内容不是字面量
+            if (!run.isEmpty())
+                run.chop(1);
+            endRun();
+            if (c == '{') {
+                while (i < pattern.size() && pattern.at(i) != '}')
+                    ++i;
+            }
+        } else if (c == '.' || c == '^' || c == '$' || c == '+' || c == ']') {
+            endRun();
+        } else if (depth == 0) {
+            run += c;
+        }
+    }
+    endRun();
+    return best;
+}
+
+} // namespace
+
+ContentSearcher::ContentSearcher(QObject *parent)
+    : QObject(parent)
+    , m_caseSensitive(false)
+    , m_useRegex(false)
+    , m_searchId(0)
+    , m_walkDone(true)
+    , m_cancelled(false)
+    , m_truncated(false)
+    , m_matchCount(0)
+    , m_running(false)
+    , m_activeWorkers(0)
+    , m_filesScanned(0)
+{
+    qRegisterMetaType<ContentMatch>("ContentMatch");
+    qRegisterMetaType<QVector<ContentMatch>>("QVector<ContentMatch>");
+}
+
+ContentSearcher::~ContentSearcher()
+{
+    cancel();
+    join();
+}
+
+int ContentSearcher::start(const QString &rootPath, const QString &pattern,
+                           const QStringList &nameFilters, bool useRegex)
+{
+    cancel();
+    join();
+
+    if (pattern.isEmpty())
+        return -1;
+
+    // 智能大小写：模式中含大写字母时才区分大小写
+    // 正则含内联标志（如 (?i)）时由正则自己决定，预筛选按不区分大小写处理
+    const bool inlineFlags = useRegex
+        && pattern.contains(QRegularExpression(QStringLiteral("\\(\\?[a-zA-Z-]+[:)]")));
+    m_caseSensitive = !inlineFlags && pattern != pattern.toLower();
+    m_useRegex = useRegex;
+
+    QString literal = pattern;
+    if (useRegex) {
+        m_regex = QRegularExpression(pattern, m_caseSensitive || inlineFlags
+                                                  ? QRegularExpression::NoPatternOption
+                                                  : QRegularExpression::CaseInsensitiveOption);
+        if (!m_regex.isValid())
+            return -1;
+        literal = requiredLiteral(pattern);
+    }
+
+    m_literal = literal.toUtf8();
+    if (!m_caseSensitive) {
+        // 非ASCII字符的大小写折叠由正则负责，此时放弃预筛选
+        if (useRegex && m_literal.size() != literal.size())
+            m_literal.clear();
+        m_literal = asciiLower(m_literal);
+    }
+
+    ++m_searchId;
+    m_queue.clear();
+    m_walkDone = false;
+    m_cancelled = false;
+    m_truncated = false;
+    m_matchCount = 0;
+    m_filesScanned = 0;
+
+    const int workerCount = qMax(1, int(std::thread::hardware_concurrency()) - 1);
+    m_activeWorkers = workerCount;
+    m_running = true;
+
+    m_threads.emplace_back(&ContentSearcher::walk, this, rootPath, nameFilters);
+    for (int i = 0; i < workerCount; ++i)
+        m_threads.emplace_back(&ContentSearcher::work, this);
+
+    return m_searchId;
+}
+
+void ContentSearcher::cancel()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_cancelled = true;
+    }
+    m_queueCond.notify_all();
+}
+
+void ContentSearcher::join()
+{
+    for (std::thread &thread : m_threads) {
+        if (thread.joinable())
+            thread.join();
+    }
+    m_threads.clear();
+}
+
+void ContentSearcher::walk(QString rootPath, QStringList nameFilters)
+{
+    QDirIterator it(rootPath, nameFilters, QDir::Files | QDir::NoDotAndDotDot,
+                    QDirIterator::Subdirectories);
+
+    std::vector<QString> pending;
+    pending.reserve(kWalkBatchSize);
+
+    auto push = [&]() {
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            for (QString &path : pending)
+                m_queue.push_back(std::move(path));
+        }
+        pending.clear();
+        m_queueCond.notify_all();
+    };
+
+    while (it.hasNext() && !m_cancelled.load(std::memory_order_relaxed)) {
+        pending.push_back(it.next());
+        if (pending.size() >= kWalkBatchSize)
+            push();
+    }
+    push();
+
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_walkDone = true;
+    }
+    m_queueCond.notify_all();
+}
+
+void ContentSearcher::work()
+{
+    QVector<ContentMatch> batch;
+
+    for (;;) {
+        QString path;
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            m_queueCond.wait(lock, [this]() {
+                return !m_queue.empty() || m_walkDone || m_cancelled.load();
+            });
+            if (m_cancelled.load() || m_queue.empty())
+                break;
+            path = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        searchFile(path, batch);
+
+        const int scanned = ++m_filesScanned;
+        if ((scanned & 0xFF) == 0) {
+            flush(batch);
+            emit progressChanged(m_searchId, scanned);
+        }
+    }
+
+    // 因达到上限而停止时，已计入总数的匹配仍需发出
+    if (!m_cancelled.load() || m_truncated.load())
+        flush(batch);
+
+    if (--m_activeWorkers == 0) {
+        m_running = false;
+        const bool truncated = m_truncated.load();
+        emit finished(m_searchId, m_cancelled.load() && !truncated, truncated);
+    }
+}
+
+void ContentSearcher::searchFile(const QString &path, QVector<ContentMatch> &out)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return;
+
+    const qint64 size = file.size();
+    if (size <= 0)
+        return;
+
+    if (size >= kMapThreshold) {
+        if (uchar *mapped = file.map(0, size)) {
+            searchBuffer(path, reinterpret_cast<const char *>(mapped), size, out);
+            file.unmap(mapped);
+            return;
+        }
+    }
+
+    // 小文件或无法映射时直接整块读取
+    const QByteArray data = file.readAll();
+    searchBuffer(path, data.constData(), data.size(), out);
+}
+
+void ContentSearcher::searchBuffer(const QString &path, const char *data, qint64 size,
+                                   QVector<ContentMatch> &out)
+{
+    // 头部含NUL字节视为二进制文件，直接跳过
+    if (std::memchr(data, 0, size_t(qMin(size, kBinaryProbeBytes))))
+        return;
+
+    const char *end = data + size;
+    const char *pos = data;        // 下一行的起始位置
+    const char *counted = data;    // 行号已统计到的位置
+    int lineNumber = 1;
+    int found = 0;
+
+    while (pos < end && found < kMaxMatchesPerFile) {
+        if (m_cancelled.load(std::memory_order_relaxed))
+            return;
+
+        const char *lineStart = pos;
+        if (!m_literal.isEmpty()) {
+            const char *hit = findLiteral(pos, end, m_literal, m_caseSensitive);
+            if (!hit)
+                break;
+            lineStart = hit;
+            while (lineStart > pos && lineStart[-1] != '\n')
+                --lineStart;
+        }
+
+        const char *lineEnd = static_cast<const char *>(
+            std::memchr(lineStart, '\n', size_t(end - lineStart)));
+        if (!lineEnd)
+            lineEnd = end;
+
+        lineNumber += int(std::count(counted, lineStart, '\n'));
+        counted = lineStart;
+
+        bool matched = true;
+        if (m_useRegex) {
+            const QString text = QString::fromUtf8(lineStart, int(lineEnd - lineStart));
+            matched = m_regex.match(text).hasMatch();
+        }
+
+        if (matched) {
+            if (!reserveMatch())
+                return;
+            ContentMatch match;
+            match.filePath = path;
+            match.lineNumber = lineNumber;
+            match.lineText = QString::fromUtf8(
+                lineStart, int(qMin<qint64>(lineEnd - lineStart, kMaxLineLength))).trimmed();
+            out.append(match);
+            ++found;
+            if (out.size() >= kMatchBatchSize)
+                flush(out);
+        }
+
+        pos = lineEnd + 1;
+    }
+}
+
+bool ContentSearcher::reserveMatch()
+{
+    if (m_matchCount.fetch_add(1, std::memory_order_relaxed) < kMaxTotalMatches)
+        return true;
+
+    // 结果已足够多，停止遍历和其他工作线程
+    m_truncated = true;
+    cancel();
+    return false;
+}
+
+void ContentSearcher::flush(QVector<ContentMatch> &batch)
+{
+    if (batch.isEmpty())
+        return;
+    emit matchesFound(m_searchId, batch);
+    batch.clear();
+}
@@ -0,0 +1,223 @@
+/**
+ * @file DirectoryCompareDialog.cpp
+ * @brief 目录比较对话框实现
+ */
+
+#include "DirectoryCompareDialog.h"
+#include "ui_DirectoryCompareDialog.h"
+#include "CompareResultModel.h"
+#include <QDir>
+#include <QEvent>
+#include <QFileDialog>
+#include <QFileInfo>
+#include <QMessageBox>
+#include <QShowEvent>
+
+namespace {
+
+#if defined(Q_OS_WIN) || defined(Q_OS_DARWIN)
+const Qt::CaseSensitivity kPathCase = Qt::CaseInsensitive;
+#else
+const Qt::CaseSensitivity kPathCase = Qt::CaseSensitive;
+#endif
+
+// 解析符号链接后的目录路径，以分隔符结尾，便于按前缀判断包含关系
+QString directoryPrefix(const QString &path)
+{
+    QString canonical = QFileInfo(path).canonicalFilePath();
+    if (!canonical.endsWith('/'))
+        canonical += '/';
+    return canonical;
+}
+
+} // namespace
+
+DirectoryCompareDialog::DirectoryCompareDialog(QWidget *parent)
+    : QDialog(parent)
+    , ui(new Ui::DirectoryCompareDialog())
+    , m_comparer(new DirectoryComparer(this))
+    , m_model(new CompareResultModel(this))
+    , m_taskId(0)
+    , m_retranslatePending(false)
+{
+    ui->setupUi(this);
+    ui->resultView->setModel(m_model);
+
+    connect(ui->leftBrowseButton, &QPushButton::clicked, this, &DirectoryCompareDialog::onBrowseLeft);
+    connect(ui->rightBrowseButton, &QPushButton::clicked, this, &DirectoryCompareDialog::onBrowseRight);
+    connect(ui->compareButton, &QPushButton::clicked, this, &DirectoryCompareDialog::onCompareClicked);
+    connect(ui->syncButton, &QPushButton::clicked, this, &DirectoryCompareDialog::onSyncClicked);
+    connect(ui->cancelButton, &QPushButton::clicked, this, &DirectoryCompareDialog::onCancelClicked);
+
+    connect(m_comparer, &DirectoryComparer::progressChanged, this, &DirectoryCompareDialog::onProgressChanged);
+    connect(m_comparer, &DirectoryComparer::compareFinished, this, &DirectoryCompareDialog::onCompareFinished);
+    connect(m_comparer, &DirectoryComparer::syncFinished, this, &DirectoryCompareDialog::onSyncFinished);
+}
+
+DirectoryCompareDialog::~DirectoryCompareDialog()
+{
+    delete ui;
+}
+
+void DirectoryCompareDialog::changeEvent(QEvent *event)
+{
+    if (event->type() == QEvent::LanguageChange) {
+        // 对话框隐藏时只做标记
+        if (isVisible())
+            retranslate();
+        else
+            m_retranslatePending = true;
+    }
+    QDialog::changeEvent(event);
+}
+
+void DirectoryCompareDialog::showEvent(QShowEvent *event)
+{
+    if (m_retranslatePending) {
+        m_retranslatePending = false;
+        retranslate();
+    }
+    QDialog::showEvent(event);
+}
+
+void DirectoryCompareDialog::retranslate()
+{
+    // 状态栏显示的是运行结果，翻译后保留
+    const QString status = ui->statusLabel->text();
+    ui->retranslateUi(this);
+    ui->statusLabel->setText(status);
+    // 比较结果的文字由模型提供，重绘后即为新语言
+    ui->resultView->viewport()->update();
+}
+
+void DirectoryCompareDialog::setLeftPath(const QString &path)
+{
+    if (!m_comparer->isRunning())
+        ui->leftEdit->setText(QDir::toNativeSeparators(path));
+}
+
+void DirectoryCompareDialog::onBrowseLeft()
+{
+    const QString path = QFileDialog::getExistingDirectory(this, tr("选择左侧目录"), ui->leftEdit->text());
+    if (!path.isEmpty())
+        ui->leftEdit->setText(QDir::toNativeSeparators(path));
+}
+
+void DirectoryCompareDialog::onBrowseRight()
+{
+    const QString path = QFileDialog::getExistingDirectory(this, tr("选择右侧目录"), ui->rightEdit->text());
+    if (!path.isEmpty())
+        ui->rightEdit->setText(QDir::toNativeSeparators(path));
+}
+
+void DirectoryCompareDialog::onCompareClicked()
+{
+    const QString left = QDir::fromNativeSeparators(ui->leftEdit->text().trimmed());
+    const QString right = QDir::fromNativeSeparators(ui->rightEdit->text().trimmed());
+    if (!QFileInfo(left).isDir() || !QFileInfo(right).isDir()) {
+        ui->statusLabel->setText(tr("请选择两个存在的目录"));
+        return;
+    }
+    // 一侧位于另一侧之内时，比较会遍历到自身，同步会把目录复制进它自己的子树
+    const QString leftPrefix = directoryPrefix(left);
+    const QString rightPrefix = directoryPrefix(right);
+    if (leftPrefix.compare(rightPrefix, kPathCase) == 0) {
+        ui->statusLabel->setText(tr("两侧是同一个目录"));
+        return;
+    }
+    if (leftPrefix.startsWith(rightPrefix, kPathCase) || rightPrefix.startsWith(leftPrefix, kPathCase)) {
+        ui->statusLabel->setText(tr("一侧目录位于另一侧之内，无法比较"));
+        return;
+    }
+
+    m_comparedLeft = left;
+    m_comparedRight = right;
+    m_model->setEntries(QVector<CompareEntry>());
+    setBusy(true);
+    m_timer.start();
+    m_taskId = m_comparer->compare(left, right);
+    ui->statusLabel->setText(tr("正在比较..."));
+}
+
+void DirectoryCompareDialog::onSyncClicked()
+{
+    const QVector<CompareEntry> &entries = m_model->entries();
+    int actionable = 0;
+    for (const CompareEntry &entry : entries) {
+        if (entry.status != CompareEntry::OnlyRight && entry.status != CompareEntry::TypeMismatch)
+            ++actionable;
+    }
+    if (actionable == 0) {
+        ui->statusLabel->setText(tr("没有需要同步的项"));
+        return;
+    }
+
+    const QMessageBox::StandardButton answer = QMessageBox::question(
+        this, tr("同步目录"),
+        tr("将把 %1 项变化从\n%2\n同步到\n%3\n\n仅右侧存在的项和类型不同的项不会改动。是否继续？")
+            .arg(actionable)
+            .arg(QDir::toNativeSeparators(m_comparedLeft), QDir::toNativeSeparators(m_comparedRight)));
+    if (answer != QMessageBox::Yes)
+        return;
+
+    setBusy(true);
+    m_timer.start();
+    m_taskId = m_comparer->sync(m_comparedLeft, m_comparedRight, entries);
+    ui->statusLabel->setText(tr("正在同步..."));
+}
+
+void DirectoryCompareDialog::onCancelClicked()
+{
+    m_comparer->cancel();
+    m_syncSummary.clear();
+    setBusy(false);
+    ui->statusLabel->setText(tr("已取消"));
+}
+
+void DirectoryCompareDialog::onProgressChanged(int taskId, const QString &message)
+{
+    if (taskId == m_taskId && m_comparer->isRunning())
+        ui->statusLabel->setText(message);
+}
+
+void DirectoryCompareDialog::onCompareFinished(int taskId, const QVector<CompareEntry> &entries,
+                                               qint64 identicalCount)
+{
+    if (taskId != m_taskId)
+        return;
+
+    m_model->setEntries(entries);
+    setBusy(false);
+    ui->syncButton->setEnabled(!entries.isEmpty());
+    const QString result = tr("差异 %1 项，相同 %2 个文件，用时 %3 秒")
+                               .arg(entries.size())
+                               .arg(identicalCount)
+                               .arg(m_timer.elapsed() / 1000.0, 0, 'f', 1);
+    ui->statusLabel->setText(m_syncSummary.isEmpty() ? result : m_syncSummary + tr("；") + result);
+    m_syncSummary.clear();
+}
+
+void DirectoryCompareDialog::onSyncFinished(int taskId, int filesWritten, qint64 bytesWritten, int failures)
+{
+    if (taskId != m_taskId)
+        return;
+
+    m_syncSummary = tr("同步完成: 写入 %1 个文件，共 %2 MB，失败 %3 项")
+                        .arg(filesWritten)
+                        .arg(bytesWritten / (1024.0 * 1024.0), 0, 'f', 1)
+                        .arg(failures);
+
+    // 重新比较以显示剩余差异
+    onCompareClicked();
+}
+
+void DirectoryCompareDialog::setBusy(bool busy)
+{
+    ui->compareButton->setEnabled(!busy);
+    ui->syncButton->setEnabled(!busy && m_model->rowCount() > 0);
+    ui->cancelButton->setEnabled(busy);
+    ui->leftEdit->setEnabled(!busy);
+    ui->rightEdit->setEnabled(!busy);
+    ui->leftBrowseButton->setEnabled(!busy);
+    ui->rightBrowseButton->setEnabled(!busy);
+}
@@ -0,0 +1,427 @@
+/**
+ * @file DirectoryComparer.cpp
+ * @brief 目录比较与同步实现
+ */
+
+#include "DirectoryComparer.h"
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QDirIterator>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QSaveFile>
+#include <QSet>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+const int kMaxVerifyThreads = 8;            // 逐块比较受磁盘限制，线程不宜过多
+const qint64 kCopyChunk = 1024 * 1024;
+const int kProgressInterval = 200;          // 毫秒
+const int kSyncProgressEvery = 64;          // 同步时每处理若干项报告一次进度
+
+struct FileStat
+{
+    qint64 size;
+    qint64 modified;   // 秒；不同文件系统的时间精度不同，只比较到秒
+    bool isDir;
+};
+
+using StatMap = QHash<QString, FileStat>;
+
+// 遍历root下的所有项（不跟随符号链接），只读取元数据
+void walkTree(const QString &root, StatMap *out, std::atomic<qint64> *counter,
+              const std::atomic<bool> &cancelled)
+{
+    const int prefix = root.size() + (root.endsWith('/') ? 0 : 1);
+    QDirIterator it(root, QDir::AllEntries | QDir::NoDotAndDotDot | QDir::Hidden
+                              | QDir::System | QDir::NoSymLinks,
+                    QDirIterator::Subdirectories);
+    while (it.hasNext() && !cancelled.load()) {
+        it.next();
+        const QFileInfo info = it.fileInfo();
+        FileStat stat;
+        stat.isDir = info.isDir();
+        stat.size = stat.isDir ? 0 : info.size();
+        stat.modified = info.lastModified().toMSecsSinceEpoch() / 1000;
+        out->insert(it.filePath().mid(prefix), stat);
+        ++*counter;
+    }
+}
+
+QString parentOf(const QString &relativePath)
+{
+    const int slash = relativePath.lastIndexOf('/');
+    return slash < 0 ? QString() : relativePath.left(slash);
+}
+
+/**
+ * 大小相同的两个文件逐块比较，返回不同的块数（出错返回-1）
+ * 优先内存映射，避免把内容复制到用户态缓冲区；映射失败时退回分块读取
+ */
+int countChangedBlocks(const QString &leftPath, const QString &rightPath, qint64 size,
+                       std::vector<qint64> *changedOffsets, const std::atomic<bool> &cancelled)
+{
+    if (size == 0)
+        return 0;
+
+    QFile left(leftPath);
+    QFile right(rightPath);
+    if (!left.open(QIODevice::ReadOnly) || !right.open(QIODevice::ReadOnly))
+        return -1;
+
+    int changed = 0;
+    uchar *l = left.map(0, size);
+    uchar *r = right.map(0, size);
+    if (l && r) {
+        for (qint64 offset = 0; offset < size && !cancelled.load(); offset += DirectoryComparer::BlockSize) {
+            const size_t length = size_t(qMin<qint64>(DirectoryComparer::BlockSize, size - offset));
+            if (std::memcmp(l + offset, r + offset, length) != 0) {
+                ++changed;
+                if (changedOffsets)
+                    changedOffsets->push_back(offset);
+            }
+        }
+    } else {
+        for (qint64 offset = 0; offset < size && !cancelled.load(); offset += DirectoryComparer::BlockSize) {
+            const QByteArray a = left.read(DirectoryComparer::BlockSize);
+            const QByteArray b = right.read(DirectoryComparer::BlockSize);
+            if (a.isEmpty() || a != b) {
+                ++changed;
+                if (changedOffsets)
+                    changedOffsets->push_back(offset);
+            }
+        }
+    }
+    if (l)
+        left.unmap(l);
+    if (r)
+        right.unmap(r);
+    return changed;
+}
+
+// 把目标文件的修改时间设为与源文件一致，下次比较时可直接按元数据判为相同
+bool copyModifiedTime(const QString &source, const QString &target)
+{
+    QFile file(target);
+    if (!file.open(QIODevice::ReadWrite))
+        return false;
+    return file.setFileTime(QFileInfo(source).lastModified(), QFileDevice::FileModificationTime);
+}
+
+bool copyFile(const QString &source, const QString &target, qint64 *bytesWritten)
+{
+    QDir().mkpath(QFileInfo(target).absolutePath());
+
+    QFile in(source);
+    QSaveFile out(target);
+    if (!in.open(QIODevice::ReadOnly) || !out.open(QIODevice::WriteOnly))
+        return false;
+
+    while (!in.atEnd()) {
+        const QByteArray chunk = in.read(kCopyChunk);
+        if (chunk.isEmpty() || out.write(chunk) != chunk.size()) {
+            out.cancelWriting();
+            return false;
+        }
+        *bytesWritten += chunk.size();
+    }
+    if (!out.commit())
+        return false;
+
+    return copyModifiedTime(source, target);
+}
+
+// 只改写不同的块（两侧大小相同）
+bool patchFile(const QString &source, const QString &target, qint64 size,
+               qint64 *bytesWritten, const std::atomic<bool> &cancelled)
+{
+    std::vector<qint64> offsets;
+    if (countChangedBlocks(source, target, size, &offsets, cancelled) < 0)
+        return false;
+
+    QFile in(source);
+    QFile out(target);
+    if (!in.open(QIODevice::ReadOnly) || !out.open(QIODevice::ReadWrite))
+        return false;
+
+    for (qint64 offset : offsets) {
+        if (!in.seek(offset) || !out.seek(offset))
+            return false;
+        const QByteArray block = in.read(DirectoryComparer::BlockSize);
+        if (out.write(block) != block.size())
+            return false;
+        *bytesWritten += block.size();
+    }
+    out.close();
+    return copyModifiedTime(source, target);
+}
+
+} // namespace
+
+DirectoryComparer::DirectoryComparer(QObject *parent)
+    : QObject(parent)
+    , m_cancelled(false)
+    , m_running(false)
+    , m_taskId(0)
+{
+    qRegisterMetaType<CompareEntry>("CompareEntry");
+    qRegisterMetaType<QVector<CompareEntry>>("QVector<CompareEntry>");
+}
+
+DirectoryComparer::~DirectoryComparer()
+{
+    stopWorker();
+}
+
+void DirectoryComparer::cancel()
+{
+    m_cancelled = true;
+}
+
+void DirectoryComparer::stopWorker()
+{
+    m_cancelled = true;
+    if (m_worker.joinable())
+        m_worker.join();
+    m_cancelled = false;
+}
+
+int DirectoryComparer::compare(const QString &leftRoot, const QString &rightRoot)
+{
+    stopWorker();
+    const int taskId = ++m_taskId;
+    m_running = true;
+    m_worker = std::thread(&DirectoryComparer::runCompare, this, taskId,
+                           QDir::cleanPath(leftRoot), QDir::cleanPath(rightRoot));
+    return taskId;
+}
+
+int DirectoryComparer::sync(const QString &leftRoot, const QString &rightRoot,
+                            const QVector<CompareEntry> &entries)
+{
+    stopWorker();
+    const int taskId = ++m_taskId;
+    m_running = true;
+    m_worker = std::thread(&DirectoryComparer::runSync, this, taskId,
+                           QDir::cleanPath(leftRoot), QDir::cleanPath(rightRoot), entries);
+    return taskId;
+}
+
+void DirectoryComparer::runCompare(int taskId, const QString &leftRoot, const QString &rightRoot)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    // 1. 左右两侧同时遍历
+    StatMap left;
+    StatMap right;
+    std::atomic<qint64> leftCount(0);
+    std::atomic<qint64> rightCount(0);
+    std::atomic<int> walkersDone(0);
+    std::thread leftWalker([&]() { walkTree(leftRoot, &left, &leftCount, m_cancelled); ++walkersDone; });
+    std::thread rightWalker([&]() { walkTree(rightRoot, &right, &rightCount, m_cancelled); ++walkersDone; });
+    while (walkersDone.load() < 2) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(kProgressInterval));
+        emit progressChanged(taskId, tr("正在读取元数据: 左侧 %1 项，右侧 %2 项")
+                                         .arg(leftCount.load()).arg(rightCount.load()));
+    }
+    leftWalker.join();
+    rightWalker.join();
+
+    // 2. 按元数据分类；仅一侧存在的目录只列出最上层
+    // 先收集到std::vector，逐块比较时各线程直接写各自的元素，结束后一次转换为QVector
+    std::vector<CompareEntry> found;
+    std::vector<size_t> candidates;   // 需要逐块确认的项
+    qint64 identical = 0;
+    QSet<QString> collapsed;
+
+    QStringList leftKeys = left.keys();
+    std::sort(leftKeys.begin(), leftKeys.end());
+    for (const QString &key : leftKeys) {
+        if (m_cancelled.load())
+            break;
+        const FileStat &l = left[key];
+        if (collapsed.contains(parentOf(key))) {
+            if (l.isDir)
+                collapsed.insert(key);
+            continue;
+        }
+
+        CompareEntry entry;
+        entry.relativePath = key;
+        entry.isDir = l.isDir;
+        entry.leftSize = l.isDir ? -1 : l.size;
+
+        auto it = right.constFind(key);
+        if (it == right.constEnd()) {
+            entry.status = CompareEntry::OnlyLeft;
+            if (l.isDir)
+                collapsed.insert(key);
+            found.push_back(entry);
+            continue;
+        }
+
+        const FileStat &r = it.value();
+        entry.rightSize = r.isDir ? -1 : r.size;
+        if (l.isDir != r.isDir) {
+            entry.status = CompareEntry::TypeMismatch;
+            collapsed.insert(key);
+            found.push_back(entry);
+            continue;
+        }
+        if (l.isDir)
+            continue;
+
+        if (l.size != r.size) {
+            entry.status = CompareEntry::Changed;
+            found.push_back(entry);
+        } else if (l.modified == r.modified) {
+            ++identical;
+        } else {
+            candidates.push_back(found.size());
+            found.push_back(entry);
+        }
+    }
+
+    QStringList rightKeys = right.keys();
+    std::sort(rightKeys.begin(), rightKeys.end());
+    for (const QString &key : rightKeys) {
+        if (m_cancelled.load())
+            break;
+        const FileStat &r = right[key];
+        if (collapsed.contains(parentOf(key))) {
+            if (r.isDir)
+                collapsed.insert(key);
+            continue;
+        }
+        if (left.contains(key))
+            continue;
+
+        CompareEntry entry;
+        entry.relativePath = key;
+        entry.status = CompareEntry::OnlyRight;
+        entry.isDir = r.isDir;
+        entry.rightSize = r.isDir ? -1 : r.size;
+        if (r.isDir)
+            collapsed.insert(key);
+        found.push_back(entry);
+    }
+
+    // 3. 大小相同、时间不同的文件并行逐块比较
+    if (!candidates.empty() && !m_cancelled.load()) {
+        const int threadCount = int(std::min<size_t>(
+            candidates.size(),
+            size_t(qMin(kMaxVerifyThreads, int(std::max(1u, std::thread::hardware_concurrency()))))));
+        std::atomic<size_t> next(0);
+        std::atomic<int> verified(0);
+        auto verify = [&]() {
+            for (size_t k = next++; k < candidates.size() && !m_cancelled.load(); k = next++) {
+                CompareEntry &entry = found[candidates[k]];
+                entry.totalBlocks = int((entry.leftSize + BlockSize - 1) / BlockSize);
+                entry.changedBlocks = countChangedBlocks(leftRoot + '/' + entry.relativePath,
+                                                         rightRoot + '/' + entry.relativePath,
+                                                         entry.leftSize, nullptr, m_cancelled);
+                entry.status = entry.changedBlocks == 0 ? CompareEntry::TimestampOnly
+                                                        : CompareEntry::Changed;
+                ++verified;
+            }
+        };
+
+        // found在此期间不再增删，各线程只写各自的元素
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; ++t)
+            threads.emplace_back(verify);
+        while (verified.load() < int(candidates.size()) && !m_cancelled.load()) {
+            emit progressChanged(taskId, tr("正在逐块比较: %1 / %2 个文件")
+                                             .arg(verified.load()).arg(candidates.size()));
+            std::this_thread::sleep_for(std::chrono::milliseconds(kProgressInterval));
+        }
+        for (std::thread &thread : threads)
+            thread.join();
+    }
+
+    QVector<CompareEntry> entries;
+    entries.reserve(int(found.size()));
+    for (CompareEntry &entry : found)
+        entries.append(std::move(entry));
+
+    qDebug() << "目录比较完成:" << left.size() << "/" << right.size() << "项，差异"
+             << entries.size() << "项，逐块比较" << candidates.size() << "个文件，耗时"
+             << timer.elapsed() << "ms";
+
+    m_running = false;
+    if (!m_cancelled.load())
+        emit compareFinished(taskId, entries, identical);
+}
+
+void DirectoryComparer::runSync(int taskId, const QString &leftRoot, const QString &rightRoot,
+                                const QVector<CompareEntry> &entries)
+{
+    int filesWritten = 0;
+    int failures = 0;
+    qint64 bytesWritten = 0;
+
+    for (int i = 0; i < entries.size() && !m_cancelled.load(); ++i) {
+        const CompareEntry &entry = entries[i];
+        const QString source = leftRoot + '/' + entry.relativePath;
+        const QString target = rightRoot + '/' + entry.relativePath;
+        bool ok = true;
+
+        switch (entry.status) {
+        case CompareEntry::OnlyLeft:
+            if (entry.isDir) {
+                // 整个目录不存在，递归复制
+                ok = QDir().mkpath(target);
+                QDirIterator it(source, QDir::AllEntries | QDir::NoDotAndDotDot | QDir::Hidden
+                                            | QDir::System | QDir::NoSymLinks,
+                                QDirIterator::Subdirectories);
+                while (it.hasNext() && !m_cancelled.load()) {
+                    it.next();
+                    const QString child = target + it.filePath().mid(source.size());
+                    if (it.fileInfo().isDir()) {
+                        ok = QDir().mkpath(child) && ok;
+                    } else if (copyFile(it.filePath(), child, &bytesWritten)) {
+                        ++filesWritten;
+                    } else {
+                        ++failures;
+                    }
+                }
+            } else {
+                ok = copyFile(source, target, &bytesWritten);
+                filesWritten += ok ? 1 : 0;
+            }
+            break;
+        case CompareEntry::Changed:
+            if (entry.changedBlocks > 0 && entry.leftSize == entry.rightSize)
+                ok = patchFile(source, target, entry.leftSize, &bytesWritten, m_cancelled);
+            else
+                ok = copyFile(source, target, &bytesWritten);
+            filesWritten += ok ? 1 : 0;
+            break;
+        case CompareEntry::TimestampOnly:
+            ok = copyModifiedTime(source, target);
+            break;
+        case CompareEntry::OnlyRight:
+        case CompareEntry::TypeMismatch:
+            break;  // 不删除、不覆盖类型不同的项
+        }
+
+        if (!ok) {
+            ++failures;
+            qDebug() << "同步失败:" << entry.relativePath;
+        }
+        if (i % kSyncProgressEvery == 0)
+            emit progressChanged(taskId, tr("正在同步: %1 / %2").arg(i + 1).arg(entries.size()));
+    }
+
+    m_running = false;
+    if (!m_cancelled.load())
+        emit syncFinished(taskId, filesWritten, bytesWritten, failures);
+}
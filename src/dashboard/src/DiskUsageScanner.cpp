@@ -0,0 +1,148 @@
+/**
+ * @file DiskUsageScanner.cpp
+ * @brief 磁盘占用并行扫描器实现
+ */
+
+#include "DiskUsageScanner.h"
+#include "SizeTree.h"
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+
+#ifdef Q_OS_UNIX
+#include <sys/stat.h>
+#endif
+
+namespace {
+
+const int kProgressInterval = 256;   // 每扫描多少个目录报告一次进度
+
+} // namespace
+
+DiskUsageScanner::DiskUsageScanner(SizeTree *tree, QObject *parent)
+    : QObject(parent)
+    , m_tree(tree)
+    , m_pending(0)
+    , m_checkDevice(false)
+    , m_rootDevice(0)
+    , m_cancelled(false)
+    , m_running(false)
+    , m_activeWorkers(0)
+    , m_directoriesScanned(0)
+{
+}
+
+DiskUsageScanner::~DiskUsageScanner()
+{
+    cancel();
+    join();
+}
+
+void DiskUsageScanner::start(const QString &rootPath)
+{
+    cancel();
+    join();
+
+    m_tree->reset(rootPath);
+
+    m_checkDevice = false;
+#ifdef Q_OS_UNIX
+    struct stat st;
+    if (::stat(QFile::encodeName(rootPath).constData(), &st) == 0) {
+        m_checkDevice = true;
+        m_rootDevice = quint64(st.st_dev);
+    }
+#endif
+
+    m_queue.clear();
+    m_queue.push_back(0);  // 根节点
+    m_pending = 1;
+    m_cancelled = false;
+    m_directoriesScanned = 0;
+
+    // 扫描以等待IO为主，线程数多于核心数
+    const int workerCount = qMax(4, int(std::thread::hardware_concurrency()) * 2);
+    m_activeWorkers = workerCount;
+    m_running = true;
+
+    for (int i = 0; i < workerCount; ++i)
+        m_threads.emplace_back(&DiskUsageScanner::work, this);
+}
+
+void DiskUsageScanner::cancel()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_cancelled = true;
+    }
+    m_queueCond.notify_all();
+}
+
+void DiskUsageScanner::join()
+{
+    for (std::thread &thread : m_threads) {
+        if (thread.joinable())
+            thread.join();
+    }
+    m_threads.clear();
+}
+
+void DiskUsageScanner::work()
+{
+    std::vector<SizeTree::Entry> entries;
+
+    for (;;) {
+        quint32 dir;
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            m_queueCond.wait(lock, [this]() {
+                return !m_queue.empty() || m_pending == 0 || m_cancelled.load();
+            });
+            if (m_cancelled.load() || m_queue.empty())
+                break;
+            dir = m_queue.front();
+            m_queue.pop_front();
+        }
+
+        // 不跟随符号链接，避免循环和重复计数
+        entries.clear();
+        QDirIterator it(m_tree->path(dir),
+                        QDir::AllEntries | QDir::NoDotAndDotDot | QDir::Hidden | QDir::System);
+        while (it.hasNext()) {
+            it.next();
+            const QFileInfo info = it.fileInfo();
+            if (info.isSymLink())
+                continue;
+            const bool isDir = info.isDir();
+#ifdef Q_OS_UNIX
+            // 挂载点下是另一个文件系统，跳过
+            if (isDir && m_checkDevice) {
+                struct stat st;
+                if (::lstat(QFile::encodeName(info.filePath()).constData(), &st) != 0
+                    || quint64(st.st_dev) != m_rootDevice)
+                    continue;
+            }
+#endif
+            entries.push_back({ info.fileName(), isDir ? 0 : quint64(info.size()), isDir });
+        }
+
+        const std::vector<quint32> subdirs = m_tree->addChildren(dir, entries);
+
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            m_queue.insert(m_queue.end(), subdirs.begin(), subdirs.end());
+            m_pending += int(subdirs.size()) - 1;
+        }
+        m_queueCond.notify_all();
+
+        const int scanned = ++m_directoriesScanned;
+        if (scanned % kProgressInterval == 0)
+            emit progressChanged(scanned);
+    }
+
+    if (--m_activeWorkers == 0) {
+        m_running = false;
+        emit finished(m_cancelled.load());
+    }
+}
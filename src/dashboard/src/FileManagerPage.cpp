@@ -5,20 +5,47 @@
 
 #include "FileManagerPage.h"
 #include "ui_FileManagerPage.h"
+#include "QuickOpenDialog.h"
+#include "DiskUsageScanner.h"
+#include "DirectoryCompareDialog.h"
+#include "BatchRenameDialog.h"
 #include <QDebug>
 #include <QDir>
 #include <QFileInfo>
+#include <QGuiApplication>
 #include <QDesktopServices>
 #include <QUrl>
 #include <QDateTime>
+#include <QEvent>
 #include <QMessageBox>
+#include <QListWidget>
+#include <QShortcut>
+#include <QShowEvent>
+#include <QStorageInfo>
+#include <QTimer>
+#include <QStandardItemModel>
+#include <QStyle>
+#include <algorithm>
 
 FileManagerPage::FileManagerPage(QWidget *parent)
     : QWidget(parent)
     , ui(new Ui::FileManagerPage())
     , m_fileModel(new QFileSystemModel(this))
-    , m_proxyModel(new QSortFilterProxyModel(this))
+    , m_metadataService(new MetadataService(this))
+    , m_proxyModel(new FileSortProxyModel(m_metadataService, this))
+    , m_resortTimer(new QTimer(this))
     , m_currentPath(QDir::homePath())
+    , m_snapshotModel(new QStandardItemModel(this))
+    , m_showingSnapshot(false)
+    , m_contentSearcher(new ContentSearcher(this))
+    , m_contentSearchId(-1)
+    , m_contentMatchCount(0)
+    , m_quickOpenDialog(nullptr)
+    , m_diskScanner(new DiskUsageScanner(&m_sizeTree, this))
+    , m_treemapRefreshTimer(new QTimer(this))
+    , m_compareDialog(nullptr)
+    , m_renameDialog(nullptr)
+    , m_retranslatePending(false)
 {
     ui->setupUi(this);
     
@@ -35,29 +62,125 @@ FileManagerPage::FileManagerPage(QWidget *parent)
     connect(ui->filterCombo, QOverload<int>::of(&QComboBox::currentIndexChanged), 
             this, &FileManagerPage::onFilterChanged);
     
-    // 初始化显示
-    updateCurrentPath(m_currentPath);
+    // 内容搜索
+    connect(ui->contentSearchCheck, &QCheckBox::toggled, this, &FileManagerPage::onContentSearchToggled);
+    connect(ui->searchEdit, &QLineEdit::returnPressed, this, &FileManagerPage::onSearchReturnPressed);
+    connect(ui->searchResultList, &QListWidget::itemActivated, this, &FileManagerPage::onSearchResultActivated);
+    connect(m_contentSearcher, &ContentSearcher::matchesFound, this, &FileManagerPage::onContentMatchesFound);
+    connect(m_contentSearcher, &ContentSearcher::progressChanged, this, &FileManagerPage::onContentSearchProgress);
+    connect(m_contentSearcher, &ContentSearcher::finished, this, &FileManagerPage::onContentSearchFinished);
+    
+    // 快速打开
+    connect(ui->quickOpenButton, &QPushButton::clicked, this, &FileManagerPage::onQuickOpenClicked);
+    QShortcut *quickOpenShortcut = new QShortcut(QKeySequence(tr("Ctrl+P")), this);
+    quickOpenShortcut->setContext(Qt::WidgetWithChildrenShortcut);
+    connect(quickOpenShortcut, &QShortcut::activated, this, &FileManagerPage::onQuickOpenClicked);
+    
+    // 占用分析
+    connect(ui->treemapButton, &QPushButton::toggled, this, &FileManagerPage::onTreemapToggled);
+    connect(ui->treemapWidget, &TreemapWidget::nodeActivated, this, &FileManagerPage::onTreemapNodeActivated);
+    connect(m_diskScanner, &DiskUsageScanner::progressChanged, this, &FileManagerPage::onDiskScanProgress);
+    connect(m_diskScanner, &DiskUsageScanner::finished, this, &FileManagerPage::onDiskScanFinished);
+    connect(m_treemapRefreshTimer, &QTimer::timeout, ui->treemapWidget, &TreemapWidget::invalidateLayout);
+    
+    // 目录比较
+    connect(ui->compareButton, &QPushButton::clicked, this, &FileManagerPage::onCompareClicked);
+    
+    // 批量重命名
+    connect(ui->renameButton, &QPushButton::clicked, this, &FileManagerPage::onRenameClicked);
+    QShortcut *renameShortcut = new QShortcut(QKeySequence(tr("F2")), this);
+    renameShortcut->setContext(Qt::WidgetWithChildrenShortcut);
+    connect(renameShortcut, &QShortcut::activated, this, &FileManagerPage::onRenameClicked);
+    
+    // 元数据与排序
+    connect(m_metadataService, &MetadataService::metadataReady, this, &FileManagerPage::onMetadataReady);
+    connect(ui->sortCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
+            this, &FileManagerPage::onSortChanged);
+    connect(ui->sortOrderButton, &QPushButton::toggled, this, &FileManagerPage::onSortChanged);
+    connect(ui->checksumCheck, &QCheckBox::toggled, this, &FileManagerPage::onChecksumToggled);
+    m_resortTimer->setSingleShot(true);
+    m_resortTimer->setInterval(200);
+    connect(m_resortTimer, &QTimer::timeout, m_proxyModel, &QSortFilterProxyModel::invalidate);
+    
+    // 初始化显示：先显示上次的快照，文件系统模型推迟到事件循环开始后再建立
+    const SessionSnapshot &snapshot = SessionSnapshot::current();
+    if (snapshot.isValid()) {
+        showSnapshot(snapshot);
+    } else {
+        ui->listView->setModel(m_proxyModel);
+    }
+    QTimer::singleShot(0, this, &FileManagerPage::reconcileWithFileSystem);
     
     qDebug() << "文件管理器页面创建完成";
 }
 
 FileManagerPage::~FileManagerPage()
 {
+    m_contentSearcher->cancel();
+    delete m_diskScanner;  // 先停止扫描线程，它们引用m_sizeTree
     delete ui;
 }
 
 void FileManagerPage::setupFileSystem()
 {
-    // 设置文件模型
-    m_fileModel->setRootPath("");
+    // 设置文件模型（根路径在reconcileWithFileSystem中设置）
     m_fileModel->setFilter(QDir::NoDotAndDotDot | QDir::AllDirs | QDir::Files);
     
     // 设置代理模型用于过滤
     m_proxyModel->setSourceModel(m_fileModel);
     m_proxyModel->setFilterCaseSensitivity(Qt::CaseInsensitive);
     m_proxyModel->setSortCaseSensitivity(Qt::CaseInsensitive);
+    m_proxyModel->sort(0, Qt::AscendingOrder);
+    
+    // 配置列表视图（右侧内容，模型在快照或文件系统就绪后设置）
+    ui->listView->setViewMode(QListView::ListMode);
+    ui->listView->setGridSize(QSize(80, 70));
+    ui->listView->setSelectionMode(QAbstractItemView::ExtendedSelection);
+    
+    // 设置过滤器选项
+    const QStringList labels = filterLabels();
+    ui->filterCombo->addItem(labels.at(0), QString());
+    ui->filterCombo->addItem(labels.at(1), QString("*.txt"));
+    ui->filterCombo->addItem(labels.at(2), QString("*.png *.jpg *.bmp"));
+    ui->filterCombo->addItem(labels.at(3), QString("*.pdf *.doc *.docx"));
+    
+    // 内容搜索结果和占用树图与文件列表共用同一区域
+    ui->treemapWidget->setTree(&m_sizeTree);
+    m_treemapRefreshTimer->setInterval(300);
+    updateContentView();
+}
+
+void FileManagerPage::showSnapshot(const SessionSnapshot &snapshot)
+{
+    m_currentPath = snapshot.lastPath;
+    m_showingSnapshot = true;
+    
+    const QIcon dirIcon = style()->standardIcon(QStyle::SP_DirIcon);
+    const QIcon fileIcon = style()->standardIcon(QStyle::SP_FileIcon);
+    int dirCount = 0;
+    for (const SnapshotEntry &entry : snapshot.entries) {
+        QStandardItem *item = new QStandardItem(entry.isDir ? dirIcon : fileIcon, entry.name);
+        item->setEditable(false);
+        if (!entry.isDir) {
+            item->setToolTip(tr("大小: %1\n修改: %2")
+                             .arg(formatFileSize(entry.size))
+                             .arg(QDateTime::fromMSecsSinceEpoch(entry.modified).toString("yyyy-MM-dd hh:mm")));
+        }
+        m_snapshotModel->appendRow(item);
+        dirCount += entry.isDir ? 1 : 0;
+    }
+    
+    ui->listView->setModel(m_snapshotModel);
+    ui->pathEdit->setText(m_currentPath);
+    ui->statusLabel->setText(tr("文件夹: %1 | 文件: %2").arg(dirCount).arg(snapshot.entries.size() - dirCount));
+}
+
+void FileManagerPage::reconcileWithFileSystem()
+{
+    // 建立文件系统模型，目录内容由其后台线程异步加载
+    connect(m_fileModel, &QFileSystemModel::directoryLoaded, this, &FileManagerPage::onDirectoryLoaded);
+    m_fileModel->setRootPath("");
     
-    // 配置树形视图（左侧导航）
     ui->treeView->setModel(m_fileModel);
     ui->treeView->setRootIndex(m_fileModel->index(QDir::rootPath()));
     ui->treeView->setColumnWidth(0, 200);
@@ -65,16 +188,99 @@ void FileManagerPage::setupFileSystem()
     ui->treeView->hideColumn(2);  // 隐藏类型列
     ui->treeView->hideColumn(3);  // 隐藏日期列
     
-    // 配置列表视图（右侧内容）
+    // 恢复上次展开的目录；仍然存在的目录记入列表，用户未再操作时下次退出也会保存
+    connect(ui->treeView, &QTreeView::expanded, this, &FileManagerPage::onTreeExpanded);
+    connect(ui->treeView, &QTreeView::collapsed, this, &FileManagerPage::onTreeCollapsed);
+    for (const QString &path : SessionSnapshot::current().expandedPaths) {
+        const QModelIndex index = m_fileModel->index(path);
+        if (!index.isValid())
+            continue;
+        ui->treeView->expand(index);
+        onTreeExpanded(index);
+    }
+    
+    // 快照中的路径可能已被删除
+    if (!QDir(m_currentPath).exists())
+        m_currentPath = QDir::homePath();
+    updateCurrentPath(m_currentPath);
+    
+    // 快照显示期间列表视图不从文件系统模型取数据，需主动请求加载当前目录，
+    // 加载完成（directoryLoaded）后再切换到实时列表
+    if (m_showingSnapshot) {
+        const QModelIndex current = m_fileModel->index(m_currentPath);
+        if (current.isValid() && m_fileModel->canFetchMore(current))
+            m_fileModel->fetchMore(current);
+        else
+            showLiveModel();
+    }
+    
+    // 保险：目录迟迟未加载完成时也不再继续显示快照
+    if (m_showingSnapshot)
+        QTimer::singleShot(2000, this, &FileManagerPage::showLiveModel);
+    
+    // 上次批量重命名中途退出时询问是否恢复
+    QTimer::singleShot(0, this, [this]() { offerRenameRecovery(); });
+}
+
+void FileManagerPage::onDirectoryLoaded(const QString &path)
+{
+    if (m_showingSnapshot && QDir::cleanPath(path) == QDir::cleanPath(m_currentPath))
+        showLiveModel();
+}
+
+void FileManagerPage::showLiveModel()
+{
+    if (!m_showingSnapshot)
+        return;
+    
+    m_showingSnapshot = false;
     ui->listView->setModel(m_proxyModel);
-    ui->listView->setViewMode(QListView::ListMode);
-    ui->listView->setGridSize(QSize(80, 70));
+    ui->listView->setRootIndex(m_proxyModel->mapFromSource(m_fileModel->index(m_currentPath)));
+    m_snapshotModel->clear();
+}
+
+void FileManagerPage::onTreeExpanded(const QModelIndex &index)
+{
+    const QString path = m_fileModel->filePath(index);
+    if (!m_expandedPaths.contains(path))
+        m_expandedPaths.append(path);
+}
+
+void FileManagerPage::onTreeCollapsed(const QModelIndex &index)
+{
+    m_expandedPaths.removeAll(m_fileModel->filePath(index));
+}
+
+void FileManagerPage::saveSnapshot(SessionSnapshot *snapshot) const
+{
+    const int kMaxSnapshotEntries = 5000;
     
-    // 设置过滤器选项
-    ui->filterCombo->addItem(tr("全部文件 (*.*)"), QString());
-    ui->filterCombo->addItem(tr("文本文件 (*.txt)"), QString("*.txt"));
-    ui->filterCombo->addItem(tr("图片文件 (*.png *.jpg *.bmp)"), QString("*.png *.jpg *.bmp"));
-    ui->filterCombo->addItem(tr("文档 (*.pdf *.doc *.docx)"), QString("*.pdf *.doc *.docx"));
+    snapshot->lastPath = m_currentPath;
+    snapshot->expandedPaths = m_expandedPaths;
+    
+    // 仍在显示快照时保留原有列表
+    if (m_showingSnapshot)
+        return;
+    
+    snapshot->entries.clear();
+    const QModelIndex root = ui->listView->rootIndex();
+    const int rows = qMin(m_proxyModel->rowCount(root), kMaxSnapshotEntries);
+    for (int row = 0; row < rows; ++row) {
+        const QFileInfo info = m_fileModel->fileInfo(m_proxyModel->mapToSource(m_proxyModel->index(row, 0, root)));
+        SnapshotEntry entry;
+        entry.name = info.fileName();
+        entry.isDir = info.isDir();
+        entry.size = info.size();
+        entry.modified = info.lastModified().toMSecsSinceEpoch();
+        snapshot->entries.append(entry);
+    }
+}
+
+QString FileManagerPage::filePathForListIndex(const QModelIndex &index) const
+{
+    if (m_showingSnapshot)
+        return QDir(m_currentPath).filePath(index.data(Qt::DisplayRole).toString());
+    return m_fileModel->filePath(m_proxyModel->mapToSource(index));
 }
 
 void FileManagerPage::onTreeClicked(const QModelIndex &index)
@@ -87,18 +293,18 @@ void FileManagerPage::onTreeClicked(const QModelIndex &index)
 
 void FileManagerPage::onListClicked(const QModelIndex &index)
 {
-    QModelIndex sourceIndex = m_proxyModel->mapToSource(index);
-    QString path = m_fileModel->filePath(sourceIndex);
+    // Ctrl/Shift 点击用于多选，不进入目录
+    if (QGuiApplication::keyboardModifiers() & (Qt::ControlModifier | Qt::ShiftModifier))
+        return;
+    
+    QString path = filePathForListIndex(index);
     QFileInfo info(path);
     
     if (info.isDir()) {
         updateCurrentPath(path);
     } else {
         // 显示文件信息
-        ui->fileNameLabel->setText(info.fileName());
-        ui->fileSizeLabel->setText(tr("大小: %1").arg(formatFileSize(info.size())));
-        ui->fileTypeLabel->setText(tr("类型: %1").arg(info.suffix().toUpper()));
-        ui->fileDateLabel->setText(tr("修改: %1").arg(info.lastModified().toString("yyyy-MM-dd hh:mm")));
+        showFileInfo(info);
         
         // 尝试打开文件
         // QDesktopServices::openUrl(QUrl::fromLocalFile(path));
@@ -138,6 +344,10 @@ void FileManagerPage::onRefreshButtonClicked()
 
 void FileManagerPage::onSearchTextChanged(const QString &text)
 {
+    // 内容搜索模式下由回车触发，不过滤文件名
+    if (ui->contentSearchCheck->isChecked())
+        return;
+    
     m_proxyModel->setFilterWildcard(text.isEmpty() ? QString() : "*" + text + "*");
 }
 
@@ -153,21 +363,456 @@ void FileManagerPage::onFilterChanged(int index)
     }
 }
 
+void FileManagerPage::onContentSearchToggled(bool checked)
+{
+    ui->regexCheck->setEnabled(checked);
+    if (checked)
+        ui->treemapButton->setChecked(false);
+    updateContentView();
+    
+    if (checked) {
+        m_proxyModel->setFilterWildcard(QString());
+        ui->searchEdit->setPlaceholderText(tr("🔍 搜索文件内容，回车开始..."));
+    } else {
+        m_contentSearcher->cancel();
+        m_contentSearchId = -1;
+        ui->searchResultList->clear();
+        ui->searchEdit->setPlaceholderText(tr("🔍 搜索文件..."));
+        onSearchTextChanged(ui->searchEdit->text());
+    }
+}
+
+void FileManagerPage::onSearchReturnPressed()
+{
+    if (!ui->contentSearchCheck->isChecked())
+        return;
+    
+    ui->searchResultList->clear();
+    m_contentMatchCount = 0;
+    m_contentSearchId = m_contentSearcher->start(m_currentPath, ui->searchEdit->text(),
+                                                 currentNameFilters(), ui->regexCheck->isChecked());
+    if (m_contentSearchId < 0) {
+        ui->statusLabel->setText(tr("搜索条件无效"));
+        return;
+    }
+    ui->statusLabel->setText(tr("正在搜索: %1 ...").arg(m_currentPath));
+}
+
+void FileManagerPage::onContentMatchesFound(int searchId, const QVector<ContentMatch> &matches)
+{
+    if (searchId != m_contentSearchId)
+        return;  // 已被新搜索取代的旧结果
+    
+    QDir root(m_currentPath);
+    for (const ContentMatch &match : matches) {
+        QListWidgetItem *item = new QListWidgetItem(
+            QString("%1:%2: %3").arg(root.relativeFilePath(match.filePath))
+                                .arg(match.lineNumber)
+                                .arg(match.lineText));
+        item->setData(Qt::UserRole, match.filePath);
+        item->setToolTip(match.filePath);
+        ui->searchResultList->addItem(item);
+    }
+    m_contentMatchCount += matches.size();
+}
+
+void FileManagerPage::onContentSearchProgress(int searchId, int filesScanned)
+{
+    if (searchId != m_contentSearchId)
+        return;
+    ui->statusLabel->setText(tr("正在搜索... 已扫描: %1 | 匹配: %2")
+                             .arg(filesScanned).arg(m_contentMatchCount));
+}
+
+void FileManagerPage::onContentSearchFinished(int searchId, bool cancelled, bool truncated)
+{
+    if (searchId != m_contentSearchId)
+        return;
+    if (truncated) {
+        ui->statusLabel->setText(tr("匹配过多，仅显示前 %1 条，请缩小搜索范围").arg(m_contentMatchCount));
+        return;
+    }
+    ui->statusLabel->setText(cancelled ? tr("搜索已取消 | 匹配: %1").arg(m_contentMatchCount)
+                                       : tr("搜索完成 | 匹配: %1").arg(m_contentMatchCount));
+}
+
+void FileManagerPage::onSearchResultActivated(QListWidgetItem *item)
+{
+    ui->contentSearchCheck->setChecked(false);
+    revealFile(item->data(Qt::UserRole).toString());
+}
+
+void FileManagerPage::onQuickOpenClicked()
+{
+    if (!m_quickOpenDialog) {
+        m_quickOpenDialog = new QuickOpenDialog(this);
+        connect(m_quickOpenDialog, &QuickOpenDialog::pathChosen,
+                this, &FileManagerPage::onQuickOpenPathChosen);
+    }
+    
+    // 以当前目录为根，根目录不变时复用已有索引
+    m_quickOpenDialog->setRootPath(m_currentPath);
+    m_quickOpenDialog->show();
+    m_quickOpenDialog->raise();
+    m_quickOpenDialog->activateWindow();
+}
+
+void FileManagerPage::changeEvent(QEvent *event)
+{
+    if (event->type() == QEvent::LanguageChange) {
+        // 只有可见页面立即重新翻译，其余页面等到下次显示
+        if (isVisible())
+            retranslate();
+        else
+            m_retranslatePending = true;
+    }
+    QWidget::changeEvent(event);
+}
+
+void FileManagerPage::showEvent(QShowEvent *event)
+{
+    if (m_retranslatePending) {
+        m_retranslatePending = false;
+        retranslate();
+    }
+    QWidget::showEvent(event);
+}
+
+QStringList FileManagerPage::filterLabels() const
+{
+    // 顺序与 setupFileSystem 中添加的过滤器一致
+    return QStringList()
+        << tr("全部文件 (*.*)")
+        << tr("文本文件 (*.txt)")
+        << tr("图片文件 (*.png *.jpg *.bmp)")
+        << tr("文档 (*.pdf *.doc *.docx)");
+}
+
+void FileManagerPage::retranslate()
+{
+    // retranslateUi 会把代码设置的文字恢复为设计时的内容，之后逐项还原
+    const QString status = ui->statusLabel->text();
+    ui->retranslateUi(this);
+    ui->statusLabel->setText(status);
+    
+    const QStringList labels = filterLabels();
+    for (int i = 0; i < labels.size() && i < ui->filterCombo->count(); ++i)
+        ui->filterCombo->setItemText(i, labels.at(i));
+    
+    ui->sortOrderButton->setText(ui->sortOrderButton->isChecked() ? "↓" : "↑");
+    ui->searchEdit->setPlaceholderText(ui->contentSearchCheck->isChecked()
+                                           ? tr("🔍 搜索文件内容，回车开始...")
+                                           : tr("🔍 搜索文件..."));
+    if (!m_selectedPath.isEmpty())
+        showFileInfo(QFileInfo(m_selectedPath));
+}
+
+void FileManagerPage::openPath(const QString &path)
+{
+    if (QFileInfo(path).isDir()) {
+        updateCurrentPath(path);
+    } else {
+        revealFile(path);
+    }
+}
+
+void FileManagerPage::onQuickOpenPathChosen(const QString &path)
+{
+    openPath(path);
+}
+
+void FileManagerPage::onTreemapToggled(bool checked)
+{
+    if (checked)
+        ui->contentSearchCheck->setChecked(false);
+    updateContentView();
+    
+    if (!checked) {
+        // 关闭时停止扫描，未完成的数据在下次打开时重新扫描
+        if (m_diskScanner->isRunning())
+            m_diskScanner->cancel();
+        m_treemapRefreshTimer->stop();
+        return;
+    }
+    
+    // 扫描当前路径所在的整个卷，已完整扫描过同一卷时直接复用
+    const QString volumeRoot = QStorageInfo(m_currentPath).rootPath();
+    if (m_sizeTree.isEmpty() || m_sizeTree.rootPath() != QDir::cleanPath(volumeRoot)
+        || !m_diskScanner->isComplete()) {
+        m_diskScanner->start(volumeRoot);
+        ui->treemapWidget->setTree(&m_sizeTree);
+        m_treemapRefreshTimer->start();
+    }
+    updateCurrentPath(m_currentPath);
+}
+
+void FileManagerPage::onTreemapNodeActivated(quint32 node)
+{
+    // 直接使用已收集的数据跳转，不再访问磁盘
+    ui->treemapWidget->setRootNode(node);
+    updateCurrentPath(m_sizeTree.path(node));
+}
+
+void FileManagerPage::onDiskScanProgress(int directoriesScanned)
+{
+    if (!ui->treemapButton->isChecked())
+        return;
+    ui->statusLabel->setText(tr("正在扫描... 目录: %1 | 节点: %2 | 内存: %3")
+                             .arg(directoriesScanned)
+                             .arg(m_sizeTree.nodeCount())
+                             .arg(formatFileSize(qint64(m_sizeTree.memoryUsage()))));
+}
+
+void FileManagerPage::onDiskScanFinished(bool cancelled)
+{
+    m_treemapRefreshTimer->stop();
+    ui->treemapWidget->invalidateLayout();
+    if (!ui->treemapButton->isChecked())
+        return;
+    ui->statusLabel->setText(tr("%1 | 总计: %2 | 节点: %3")
+                             .arg(cancelled ? tr("扫描已取消") : tr("扫描完成"))
+                             .arg(formatFileSize(qint64(m_sizeTree.size(0))))
+                             .arg(m_sizeTree.nodeCount()));
+}
+
+void FileManagerPage::onCompareClicked()
+{
+    if (!m_compareDialog)
+        m_compareDialog = new DirectoryCompareDialog(this);
+
+    // 以当前目录作为左侧（源）
+    m_compareDialog->setLeftPath(m_currentPath);
+    m_compareDialog->show();
+    m_compareDialog->raise();
+    m_compareDialog->activateWindow();
+}
+
+void FileManagerPage::onRenameClicked()
+{
+    if (m_showingSnapshot) {
+        ui->statusLabel->setText(tr("文件列表加载中，请稍候"));
+        return;
+    }
+    
+    if (offerRenameRecovery())
+        return;
+    
+    QModelIndexList indexes = ui->listView->selectionModel()->selectedIndexes();
+    if (indexes.isEmpty()) {
+        ui->statusLabel->setText(tr("请先在列表中选择文件（Ctrl/Shift 多选）"));
+        return;
+    }
+    
+    // 按显示顺序排列，序号与列表一致
+    std::sort(indexes.begin(), indexes.end(), [](const QModelIndex &a, const QModelIndex &b) {
+        return a.row() < b.row();
+    });
+    QStringList names;
+    names.reserve(indexes.size());
+    for (const QModelIndex &index : indexes)
+        names << m_fileModel->fileName(m_proxyModel->mapToSource(index));
+    
+    renameDialog()->setFiles(m_currentPath, names);
+    m_renameDialog->show();
+    m_renameDialog->raise();
+    m_renameDialog->activateWindow();
+}
+
+BatchRenameDialog *FileManagerPage::renameDialog()
+{
+    if (!m_renameDialog) {
+        m_renameDialog = new BatchRenameDialog(this);
+        connect(m_renameDialog, &BatchRenameDialog::batchStarted, this, &FileManagerPage::onBatchStarted);
+        connect(m_renameDialog, &BatchRenameDialog::batchFinished, this, &FileManagerPage::onBatchFinished);
+    }
+    return m_renameDialog;
+}
+
+bool FileManagerPage::offerRenameRecovery()
+{
+    // 本进程正在执行的批次也会写恢复日志
+    if (m_renameDialog && m_renameDialog->isRunning())
+        return false;
+    
+    const RenameRecoveryLog log = RenameRecoveryLog::pending();
+    if (log.isEmpty())
+        return false;
+    
+    const QMessageBox::StandardButton answer = QMessageBox::question(
+        this, tr("批量重命名"),
+        tr("上次在 %1 中的批量重命名没有正常结束（共 %2 步），部分文件可能仍是临时名称。
+
+"
+           "是：恢复为执行前的名称
+否：暂不处理，下次再询问
+丢弃：删除这条记录，不再恢复")
+            .arg(QDir::toNativeSeparators(log.directory))
+            .arg(log.from.size()),
+        QMessageBox::Yes | QMessageBox::No | QMessageBox::Discard, QMessageBox::Yes);
+    if (answer == QMessageBox::Discard) {
+        RenameRecoveryLog::discard();
+        return false;
+    }
+    if (answer != QMessageBox::Yes)
+        return false;
+    
+    renameDialog()->recover(log);
+    m_renameDialog->show();
+    m_renameDialog->raise();
+    m_renameDialog->activateWindow();
+    return true;
+}
+
+void FileManagerPage::onBatchStarted(const QString &directory)
+{
+    Q_UNUSED(directory)
+    // 执行期间文件系统模型会陆续收到变化，暂停代理的逐项重排
+    m_proxyModel->setDynamicSortFilter(false);
+}
+
+void FileManagerPage::onBatchFinished(const QString &directory)
+{
+    // 结束后整体重排一次
+    m_proxyModel->setDynamicSortFilter(true);
+    m_proxyModel->invalidate();
+    if (QDir::cleanPath(directory) == QDir::cleanPath(m_currentPath))
+        ui->listView->clearSelection();
+}
+
+void FileManagerPage::updateContentView()
+{
+    const bool showResults = ui->contentSearchCheck->isChecked();
+    const bool showTreemap = ui->treemapButton->isChecked();
+    ui->searchResultList->setVisible(showResults);
+    ui->treemapWidget->setVisible(showTreemap);
+    ui->listView->setVisible(!showResults && !showTreemap);
+}
+
+QStringList FileManagerPage::currentNameFilters() const
+{
+    const QString filter = ui->filterCombo->currentData().toString();
+    return filter.isEmpty() ? QStringList() : filter.split(' ');
+}
+
 void FileManagerPage::updateCurrentPath(const QString &path)
 {
     m_currentPath = path;
     ui->pathEdit->setText(path);
     
+    // 离开快照中的目录后立即切换到实时模型
+    if (m_showingSnapshot && QDir::cleanPath(path) != QDir::cleanPath(SessionSnapshot::current().lastPath))
+        showLiveModel();
+    
     // 更新列表视图根索引
-    QModelIndex index = m_fileModel->index(path);
-    QModelIndex proxyIndex = m_proxyModel->mapFromSource(index);
-    ui->listView->setRootIndex(proxyIndex);
-    
-    // 更新状态栏
-    QDir dir(path);
-    int fileCount = dir.entryList(QDir::Files).count();
-    int dirCount = dir.entryList(QDir::Dirs | QDir::NoDotAndDotDot).count();
+    if (!m_showingSnapshot) {
+        QModelIndex index = m_fileModel->index(path);
+        QModelIndex proxyIndex = m_proxyModel->mapFromSource(index);
+        ui->listView->setRootIndex(proxyIndex);
+    }
+    
+    // 更新状态栏，树图模式下使用已扫描的数据
+    int fileCount = 0;
+    int dirCount = 0;
+    const quint32 node = ui->treemapButton->isChecked() ? m_sizeTree.find(path) : SizeTree::InvalidNode;
+    if (node != SizeTree::InvalidNode) {
+        ui->treemapWidget->setRootNode(node);
+        m_sizeTree.countChildren(node, &dirCount, &fileCount);
+    } else {
+        QDir dir(path);
+        fileCount = dir.entryList(QDir::Files).count();
+        dirCount = dir.entryList(QDir::Dirs | QDir::NoDotAndDotDot).count();
+    }
     ui->statusLabel->setText(tr("文件夹: %1 | 文件: %2").arg(dirCount).arg(fileCount));
+    
+    prefetchMetadata();
+}
+
+void FileManagerPage::revealFile(const QString &path)
+{
+    // 跳转到所在目录，选中文件并显示其信息
+    QFileInfo info(path);
+    updateCurrentPath(info.absolutePath());
+    if (!m_showingSnapshot)
+        ui->listView->setCurrentIndex(m_proxyModel->mapFromSource(m_fileModel->index(path)));
+    showFileInfo(info);
+}
+
+void FileManagerPage::showFileInfo(const QFileInfo &info)
+{
+    ui->fileNameLabel->setText(info.fileName());
+    ui->fileSizeLabel->setText(tr("大小: %1").arg(formatFileSize(info.size())));
+    ui->fileTypeLabel->setText(tr("类型: %1").arg(info.suffix().toUpper()));
+    ui->fileDateLabel->setText(tr("修改: %1").arg(info.lastModified().toString("yyyy-MM-dd hh:mm")));
+    
+    // 扩展元数据：命中缓存立即显示，否则以高优先级提取
+    m_selectedPath = info.absoluteFilePath();
+    FileMetadata meta;
+    if (m_metadataService->request(info, MetadataService::HighPriority,
+                                   ui->checksumCheck->isChecked(), &meta)) {
+        showMetadata(meta);
+    } else {
+        ui->fileMetaLabel->setText(tr("正在读取元数据..."));
+    }
+}
+
+void FileManagerPage::showMetadata(const FileMetadata &meta)
+{
+    QStringList lines;
+    if (meta.width > 0)
+        lines << tr("尺寸: %1 × %2").arg(meta.width).arg(meta.height);
+    if (!meta.cameraModel.isEmpty())
+        lines << tr("相机: %1").arg(meta.cameraModel);
+    if (!meta.dateTaken.isEmpty())
+        lines << tr("拍摄: %1").arg(meta.dateTaken);
+    if (meta.durationSeconds > 0.0) {
+        const int seconds = int(meta.durationSeconds + 0.5);
+        lines << tr("时长: %1:%2").arg(seconds / 60).arg(seconds % 60, 2, 10, QChar('0'));
+    }
+    if (!meta.textEncoding.isEmpty())
+        lines << tr("编码: %1").arg(meta.textEncoding);
+    if (meta.lineCount >= 0)
+        lines << tr("行数: %1").arg(meta.lineCount);
+    if (!meta.checksum.isEmpty())
+        lines << tr("SHA-256: %1").arg(meta.checksum);
+    ui->fileMetaLabel->setText(lines.join('\n'));
+}
+
+void FileManagerPage::onMetadataReady(const QString &path, const FileMetadata &meta)
+{
+    if (path == m_selectedPath)
+        showMetadata(meta);
+    
+    if (m_proxyModel->sortKeyNeedsMetadata())
+        m_resortTimer->start();
+}
+
+void FileManagerPage::onSortChanged()
+{
+    const Qt::SortOrder order = ui->sortOrderButton->isChecked() ? Qt::DescendingOrder
+                                                                 : Qt::AscendingOrder;
+    ui->sortOrderButton->setText(order == Qt::AscendingOrder ? "↑" : "↓");
+    m_proxyModel->setSortKey(static_cast<FileSortProxyModel::SortKey>(ui->sortCombo->currentIndex()));
+    m_proxyModel->sort(0, order);
+    prefetchMetadata();
+}
+
+void FileManagerPage::onChecksumToggled(bool checked)
+{
+    if (checked && !m_selectedPath.isEmpty())
+        showFileInfo(QFileInfo(m_selectedPath));
+}
+
+void FileManagerPage::prefetchMetadata()
+{
+    // 切换目录后旧目录的预取任务已无意义
+    m_metadataService->clearPrefetch();
+    if (!m_proxyModel->sortKeyNeedsMetadata())
+        return;
+    
+    FileMetadata meta;
+    const QFileInfoList files = QDir(m_currentPath).entryInfoList(QDir::Files);
+    for (const QFileInfo &info : files)
+        m_metadataService->request(info, MetadataService::LowPriority, false, &meta);
 }
 
 QString FileManagerPage::getSelectedFilePath() const
@@ -175,8 +820,7 @@ QString FileManagerPage::getSelectedFilePath() const
     QModelIndex index = ui->listView->currentIndex();
     if (!index.isValid()) return QString();
     
-    QModelIndex sourceIndex = m_proxyModel->mapToSource(index);
-    return m_fileModel->filePath(sourceIndex);
+    return filePathForListIndex(index);
 }
 
 QString FileManagerPage::formatFileSize(qint64 size) const
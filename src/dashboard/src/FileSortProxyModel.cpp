@@ -0,0 +1,81 @@
+/**
+ * @file FileSortProxyModel.cpp
+ * @brief 文件列表排序代理实现
+ */
+
+#include "FileSortProxyModel.h"
+#include "MetadataService.h"
+#include <QDateTime>
+#include <QFileInfo>
+#include <QFileSystemModel>
+
+FileSortProxyModel::FileSortProxyModel(MetadataService *metadata, QObject *parent)
+    : QSortFilterProxyModel(parent)
+    , m_metadata(metadata)
+    , m_sortKey(SortByName)
+{
+}
+
+void FileSortProxyModel::setSortKey(SortKey key)
+{
+    if (key == m_sortKey)
+        return;
+    m_sortKey = key;
+    invalidate();
+}
+
+double FileSortProxyModel::metadataKey(const QFileInfo &info) const
+{
+    FileMetadata meta;
+    if (!m_metadata->cached(info, &meta))
+        return -1.0;
+
+    switch (m_sortKey) {
+    case SortByDimensions:
+        return meta.width > 0 ? double(meta.width) * meta.height : -1.0;
+    case SortByLineCount:
+        return double(meta.lineCount);
+    case SortByDuration:
+        return meta.durationSeconds > 0.0 ? meta.durationSeconds : -1.0;
+    default:
+        return -1.0;
+    }
+}
+
+bool FileSortProxyModel::lessThan(const QModelIndex &left, const QModelIndex &right) const
+{
+    QFileSystemModel *model = qobject_cast<QFileSystemModel *>(sourceModel());
+    if (!model)
+        return QSortFilterProxyModel::lessThan(left, right);
+
+    const QFileInfo l = model->fileInfo(left);
+    const QFileInfo r = model->fileInfo(right);
+
+    // 目录始终在前（不受升降序影响）
+    if (l.isDir() != r.isDir())
+        return (sortOrder() == Qt::AscendingOrder) == l.isDir();
+
+    switch (m_sortKey) {
+    case SortBySize:
+        if (l.size() != r.size())
+            return l.size() < r.size();
+        break;
+    case SortByModified:
+        if (l.lastModified() != r.lastModified())
+            return l.lastModified() < r.lastModified();
+        break;
+    case SortByDimensions:
+    case SortByLineCount:
+    case SortByDuration: {
+        const double lk = metadataKey(l);
+        const double rk = metadataKey(r);
+        if (lk != rk)
+            return lk < rk;
+        break;
+    }
+    default:
+        break;
+    }
+
+    return l.fileName().compare(r.fileName(), Qt::CaseInsensitive) < 0;
+}
@@ -0,0 +1,251 @@
+/**
+ * @file FuzzyMatcher.cpp
+ * @brief 路径模糊匹配器实现
+ */
+
+#include "FuzzyMatcher.h"
+#include <algorithm>
+#include <thread>
+
+namespace {
+
+// 计分参数
+const int kScoreMatch = 16;
+const int kBonusConsecutive = 12;
+const int kBonusBoundary = 10;
+const int kBonusBasename = 6;
+const int kPenaltyGapStart = 3;
+const int kPenaltyGapExtension = 1;
+
+// 少于该数量的候选不值得启动多线程
+const size_t kParallelThreshold = 32 * 1024;
+
+inline char lowerAscii(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? char(c | 0x20) : c;
+}
+
+inline bool isBoundaryChar(char c)
+{
+    return c == '/' || c == '\\' || c == '_' || c == '-' || c == '.' || c == ' ';
+}
+
+// 排序时得分高的在前；用作堆比较时得分最低的在堆顶，便于淘汰
+inline bool betterMatch(const FuzzyMatcher::Match &a, const FuzzyMatcher::Match &b)
+{
+    if (a.score != b.score)
+        return a.score > b.score;
+    return a.index < b.index;
+}
+
+} // namespace
+
+FuzzyMatcher::FuzzyMatcher()
+    : m_scannedCount(0)
+{
+    m_offsets.push_back(0);
+}
+
+void FuzzyMatcher::clear()
+{
+    m_pool.clear();
+    m_offsets.assign(1, 0);
+    m_masks.clear();
+    m_lastQuery.clear();
+    m_survivors.clear();
+    m_scannedCount = 0;
+}
+
+void FuzzyMatcher::addPaths(const QStringList &paths)
+{
+    for (const QString &path : paths) {
+        const QByteArray utf8 = path.toUtf8();
+        m_pool.append(utf8.constData(), size_t(utf8.size()));
+        m_offsets.push_back(quint32(m_pool.size()));
+        m_masks.push_back(charMask(utf8.constData(), utf8.size()));
+    }
+}
+
+QString FuzzyMatcher::path(quint32 index) const
+{
+    const quint32 begin = m_offsets[index];
+    return QString::fromUtf8(m_pool.data() + begin, int(m_offsets[index + 1] - begin));
+}
+
+quint64 FuzzyMatcher::charMask(const char *s, int len)
+{
+    // 位0-25: a-z，位26-35: 0-9，位36-62: 其他ASCII按值散列，位63: 非ASCII
+    quint64 mask = 0;
+    for (int i = 0; i < len; ++i) {
+        const unsigned char c = static_cast<unsigned char>(lowerAscii(s[i]));
+        if (c >= 'a' && c <= 'z')
+            mask |= quint64(1) << (c - 'a');
+        else if (c >= '0' && c <= '9')
+            mask |= quint64(1) << (26 + c - '0');
+        else if (c < 0x80)
+            mask |= quint64(1) << (36 + c % 27);
+        else
+            mask |= quint64(1) << 63;
+    }
+    return mask;
+}
+
+/**
+ * 子序列计分
+ * 先正向找到最早完成匹配的位置，再反向收缩得到最短窗口，
+ * 最后在窗口内按连续、词边界、文件名部分加分，按间隔扣分。
+ */
+bool FuzzyMatcher::score(const char *s, int len, const QByteArray &query, int *result)
+{
+    const int qlen = query.size();
+    const char *q = query.constData();
+
+    int qi = 0;
+    int end = -1;
+    for (int i = 0; i < len; ++i) {
+        if (lowerAscii(s[i]) == q[qi] && ++qi == qlen) {
+            end = i;
+            break;
+        }
+    }
+    if (end < 0)
+        return false;
+
+    qi = qlen - 1;
+    int start = end;
+    for (int i = end; i >= 0; --i) {
+        if (lowerAscii(s[i]) == q[qi] && --qi < 0) {
+            start = i;
+            break;
+        }
+    }
+
+    int basenameStart = 0;
+    for (int i = len - 1; i >= 0; --i) {
+        if (s[i] == '/' || s[i] == '\\') {
+            basenameStart = i + 1;
+            break;
+        }
+    }
+
+    int total = 0;
+    bool prevMatched = false;
+    bool inGap = false;
+    qi = 0;
+    for (int i = start; i <= end && qi < qlen; ++i) {
+        if (lowerAscii(s[i]) == q[qi]) {
+            total += kScoreMatch;
+            if (prevMatched)
+                total += kBonusConsecutive;
+            if (i == 0 || isBoundaryChar(s[i - 1])
+                || (s[i] >= 'A' && s[i] <= 'Z' && s[i - 1] >= 'a' && s[i - 1] <= 'z'))
+                total += kBonusBoundary;
+            if (i >= basenameStart)
+                total += kBonusBasename;
+            prevMatched = true;
+            inGap = false;
+            ++qi;
+        } else {
+            total -= inGap ? kPenaltyGapExtension : kPenaltyGapStart;
+            prevMatched = false;
+            inGap = true;
+        }
+    }
+
+    // 同分时短路径优先
+    *result = total - len / 16;
+    return true;
+}
+
+QVector<FuzzyMatcher::Match> FuzzyMatcher::match(const QString &query, int limit)
+{
+    QByteArray needle = query.toUtf8();
+    for (int i = 0; i < needle.size(); ++i)
+        needle[i] = lowerAscii(needle[i]);
+
+    const quint32 total = quint32(m_masks.size());
+
+    // 新查询是上次查询的延伸时只需检查上次的命中项和之后新增的路径
+    std::vector<quint32> previous;
+    quint32 rangeBegin = 0;
+    if (!m_lastQuery.isEmpty() && needle.startsWith(m_lastQuery)) {
+        previous.swap(m_survivors);
+        rangeBegin = m_scannedCount;
+    }
+    m_survivors.clear();
+    m_lastQuery = needle;
+    m_scannedCount = total;
+
+    if (needle.isEmpty())
+        return QVector<Match>();
+
+    const quint64 needleMask = charMask(needle.constData(), needle.size());
+    const size_t candidateCount = previous.size() + (total - rangeBegin);
+
+    auto candidateAt = [&](size_t k) -> quint32 {
+        return k < previous.size() ? previous[k] : rangeBegin + quint32(k - previous.size());
+    };
+
+    struct Partial
+    {
+        std::vector<quint32> survivors;
+        std::vector<Match> heap;
+    };
+
+    auto scan = [&](size_t from, size_t to, Partial *out) {
+        for (size_t k = from; k < to; ++k) {
+            const quint32 index = candidateAt(k);
+            if ((m_masks[index] & needleMask) != needleMask)
+                continue;
+
+            const quint32 begin = m_offsets[index];
+            int value = 0;
+            if (!score(m_pool.data() + begin, int(m_offsets[index + 1] - begin), needle, &value))
+                continue;
+
+            out->survivors.push_back(index);
+            const Match m = { index, value };
+            if (int(out->heap.size()) < limit) {
+                out->heap.push_back(m);
+                std::push_heap(out->heap.begin(), out->heap.end(), betterMatch);
+            } else if (limit > 0 && betterMatch(m, out->heap.front())) {
+                std::pop_heap(out->heap.begin(), out->heap.end(), betterMatch);
+                out->heap.back() = m;
+                std::push_heap(out->heap.begin(), out->heap.end(), betterMatch);
+            }
+        }
+    };
+
+    int threadCount = 1;
+    if (candidateCount >= kParallelThreshold)
+        threadCount = qMax(1, int(std::thread::hardware_concurrency()));
+
+    std::vector<Partial> partials(size_t(threadCount));
+    const size_t chunk = (candidateCount + size_t(threadCount) - 1) / size_t(threadCount);
+    std::vector<std::thread> threads;
+    for (int t = 1; t < threadCount; ++t) {
+        const size_t from = qMin(candidateCount, chunk * size_t(t));
+        const size_t to = qMin(candidateCount, from + chunk);
+        threads.emplace_back(scan, from, to, &partials[size_t(t)]);
+    }
+    scan(0, qMin(candidateCount, chunk), &partials[0]);
+    for (std::thread &thread : threads)
+        thread.join();
+
+    // 按线程顺序合并，保持命中集合的原有顺序
+    std::vector<Match> best;
+    for (Partial &partial : partials) {
+        m_survivors.insert(m_survivors.end(), partial.survivors.begin(), partial.survivors.end());
+        best.insert(best.end(), partial.heap.begin(), partial.heap.end());
+    }
+
+    std::sort(best.begin(), best.end(), betterMatch);
+    if (int(best.size()) > limit)
+        best.resize(size_t(limit));
+
+    QVector<Match> results;
+    results.reserve(int(best.size()));
+    for (const Match &m : best)
+        results.append(m);
+    return results;
+}
@@ -0,0 +1,126 @@
+/**
+ * @file MetadataCache.cpp
+ * @brief 元数据持久化缓存实现
+ */
+
+#include "MetadataCache.h"
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+
+namespace {
+
+const quint32 kCacheMagic = 0x4D455441;   // "META"
+const quint32 kCacheVersion = 1;
+
+} // namespace
+
+QDataStream &operator<<(QDataStream &out, const FileMetadata &meta)
+{
+    out << meta.size << meta.modified
+        << qint32(meta.width) << qint32(meta.height) << meta.cameraModel << meta.dateTaken
+        << meta.durationSeconds
+        << meta.textEncoding << meta.lineCount
+        << meta.checksum;
+    return out;
+}
+
+QDataStream &operator>>(QDataStream &in, FileMetadata &meta)
+{
+    qint32 width = 0;
+    qint32 height = 0;
+    in >> meta.size >> meta.modified
+       >> width >> height >> meta.cameraModel >> meta.dateTaken
+       >> meta.durationSeconds
+       >> meta.textEncoding >> meta.lineCount
+       >> meta.checksum;
+    meta.width = width;
+    meta.height = height;
+    return in;
+}
+
+MetadataCache::MetadataCache(const QString &filePath)
+    : m_filePath(filePath)
+    , m_loaded(false)
+    , m_dirty(false)
+{
+}
+
+MetadataCache::~MetadataCache()
+{
+    save();
+}
+
+bool MetadataCache::lookup(const QString &path, qint64 size, qint64 modified, FileMetadata *meta) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ensureLoaded();
+    auto it = m_entries.constFind(path);
+    if (it == m_entries.constEnd() || it->size != size || it->modified != modified)
+        return false;
+    *meta = *it;
+    return true;
+}
+
+void MetadataCache::insert(const QString &path, const FileMetadata &meta)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ensureLoaded();
+    m_entries.insert(path, meta);
+    m_dirty = true;
+}
+
+// 调用者需持有m_mutex
+void MetadataCache::ensureLoaded() const
+{
+    if (m_loaded)
+        return;
+    m_loaded = true;
+
+    QFile file(m_filePath);
+    if (!file.open(QIODevice::ReadOnly))
+        return;
+
+    QDataStream in(&file);
+    quint32 magic = 0;
+    quint32 version = 0;
+    in >> magic >> version;
+    if (magic != kCacheMagic || version != kCacheVersion) {
+        qDebug() << "元数据缓存格式不匹配，已忽略:" << m_filePath;
+        return;
+    }
+
+    in.setVersion(QDataStream::Qt_5_0);
+    in >> m_entries;
+    if (in.status() != QDataStream::Ok)
+        m_entries.clear();
+
+    qDebug() << "元数据缓存已加载:" << m_entries.size() << "条";
+}
+
+bool MetadataCache::save()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_dirty)
+        return true;
+
+    QDir().mkpath(QFileInfo(m_filePath).absolutePath());
+
+    // 先写临时文件再替换，避免中途退出损坏缓存
+    QSaveFile file(m_filePath);
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    QDataStream out(&file);
+    out << kCacheMagic << kCacheVersion;
+    out.setVersion(QDataStream::Qt_5_0);
+    out << m_entries;
+
+    if (!file.commit())
+        return false;
+
+    m_dirty = false;
+    return true;
+}
@@ -0,0 +1,372 @@
+/**
+ * @file MetadataService.cpp
+ * @brief 后台元数据提取服务实现
+ */
+
+#include "MetadataService.h"
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QStandardPaths>
+#include <algorithm>
+
+namespace {
+
+const int kWorkerCount = 2;                           // 提取以IO为主，两个线程足够
+const qint64 kHeaderBytes = 4096;                     // 识别格式时读取的头部字节数
+const qint64 kMaxLineCountBytes = 256 * 1024 * 1024;  // 超过该大小的文本不统计行数
+const int kMaxJpegSegments = 64;
+const qint64 kHashChunkBytes = 1024 * 1024;           // 校验和按块计算，块间检查是否正在退出
+
+inline quint16 be16(const uchar *p) { return quint16((p[0] << 8) | p[1]); }
+inline quint32 be32(const uchar *p) { return (quint32(p[0]) << 24) | (quint32(p[1]) << 16) | (quint32(p[2]) << 8) | p[3]; }
+inline quint16 le16(const uchar *p) { return quint16(p[0] | (p[1] << 8)); }
+inline quint32 le32(const uchar *p) { return quint32(p[0]) | (quint32(p[1]) << 8) | (quint32(p[2]) << 16) | (quint32(p[3]) << 24); }
+
+// 严格校验UTF-8；末尾被截断的多字节序列视为有效
+bool isValidUtf8(const uchar *p, qint64 size, bool *pureAscii)
+{
+    *pureAscii = true;
+    qint64 i = 0;
+    while (i < size) {
+        const uchar c = p[i];
+        if (c < 0x80) {
+            ++i;
+            continue;
+        }
+        *pureAscii = false;
+        int extra = 0;
+        if ((c & 0xE0) == 0xC0 && c >= 0xC2)
+            extra = 1;
+        else if ((c & 0xF0) == 0xE0)
+            extra = 2;
+        else if ((c & 0xF8) == 0xF0 && c <= 0xF4)
+            extra = 3;
+        else
+            return false;
+        for (int k = 1; k <= extra; ++k) {
+            if (i + k >= size)
+                return true;
+            if ((p[i + k] & 0xC0) != 0x80)
+                return false;
+        }
+        i += extra + 1;
+    }
+    return true;
+}
+
+} // namespace
+
+MetadataService::MetadataService(QObject *parent)
+    : QObject(parent)
+    , m_cache(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/metadata.cache")
+    , m_sequence(0)
+    , m_stopping(false)
+{
+    qRegisterMetaType<FileMetadata>("FileMetadata");
+
+    for (int i = 0; i < kWorkerCount; ++i)
+        m_threads.emplace_back(&MetadataService::work, this);
+}
+
+MetadataService::~MetadataService()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_stopping = true;
+    }
+    m_queueCond.notify_all();
+    for (std::thread &thread : m_threads)
+        thread.join();
+}
+
+bool MetadataService::cached(const QFileInfo &info, FileMetadata *meta) const
+{
+    return m_cache.lookup(info.absoluteFilePath(), info.size(),
+                          info.lastModified().toMSecsSinceEpoch(), meta);
+}
+
+bool MetadataService::request(const QFileInfo &info, Priority priority, bool withChecksum,
+                              FileMetadata *meta)
+{
+    if (cached(info, meta) && (!withChecksum || !meta->checksum.isEmpty()))
+        return true;
+
+    const QString path = info.absoluteFilePath();
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        auto it = m_queued.find(path);
+        if (it != m_queued.end() && it.value() >= priority && !withChecksum)
+            return false;  // 已在队列中
+
+        m_queued.insert(path, priority);
+        m_queue.push({ priority, m_sequence++, path, withChecksum });
+    }
+    m_queueCond.notify_one();
+    return false;
+}
+
+void MetadataService::clearPrefetch()
+{
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+
+    std::priority_queue<Task> kept;
+    while (!m_queue.empty()) {
+        const Task &task = m_queue.top();
+        if (task.priority > LowPriority)
+            kept.push(task);
+        else
+            m_queued.remove(task.path);
+        m_queue.pop();
+    }
+    m_queue.swap(kept);
+}
+
+void MetadataService::work()
+{
+    for (;;) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            m_queueCond.wait(lock, [this]() { return !m_queue.empty() || m_stopping.load(); });
+            if (m_stopping.load())
+                break;
+            task = m_queue.top();
+            m_queue.pop();
+            m_queued.remove(task.path);
+        }
+
+        // 同一文件可能被重复排队，先查缓存
+        const QFileInfo info(task.path);
+        FileMetadata meta;
+        if (cached(info, &meta) && (!task.withChecksum || !meta.checksum.isEmpty()))
+            continue;
+
+        meta = extract(task.path, task.withChecksum);
+        if (!meta.isValid())
+            continue;
+
+        m_cache.insert(task.path, meta);
+        emit metadataReady(task.path, meta);
+    }
+}
+
+FileMetadata MetadataService::extract(const QString &path, bool withChecksum) const
+{
+    FileMetadata meta;
+    const QFileInfo info(path);
+    QFile file(path);
+    if (!info.isFile() || !file.open(QIODevice::ReadOnly))
+        return meta;
+
+    meta.size = info.size();
+    meta.modified = info.lastModified().toMSecsSinceEpoch();
+
+    const QByteArray header = file.read(kHeaderBytes);
+    readImageHeader(file, header, &meta);
+    if (meta.width == 0)
+        readWavHeader(header, &meta);
+    if (meta.width == 0 && meta.durationSeconds <= 0.0)
+        readText(file, header, &meta);
+
+    if (withChecksum && file.seek(0)) {
+        QCryptographicHash hash(QCryptographicHash::Sha256);
+        QByteArray chunk;
+        bool complete = true;
+        while (!file.atEnd()) {
+            if (m_stopping.load()) {
+                complete = false;
+                break;
+            }
+            chunk = file.read(kHashChunkBytes);
+            if (chunk.isEmpty()) {
+                complete = false;
+                break;
+            }
+            hash.addData(chunk);
+        }
+        if (complete)
+            meta.checksum = QString::fromLatin1(hash.result().toHex());
+    }
+
+    return meta;
+}
+
+void MetadataService::readImageHeader(QFile &file, const QByteArray &header, FileMetadata *meta)
+{
+    const uchar *p = reinterpret_cast<const uchar *>(header.constData());
+    const int n = header.size();
+
+    if (n >= 24 && header.startsWith("\x89PNG\r\n\x1a\n")) {
+        meta->width = int(be32(p + 16));
+        meta->height = int(be32(p + 20));
+    } else if (n >= 10 && header.startsWith("GIF8")) {
+        meta->width = le16(p + 6);
+        meta->height = le16(p + 8);
+    } else if (n >= 26 && header.startsWith("BM")) {
+        meta->width = int(le32(p + 18));
+        meta->height = qAbs(int(le32(p + 22)));  // 负值表示自上而下存储
+    } else if (n >= 3 && p[0] == 0xFF && p[1] == 0xD8 && p[2] == 0xFF) {
+        readJpeg(file, meta);
+    }
+}
+
+void MetadataService::readJpeg(QFile &file, FileMetadata *meta)
+{
+    // 逐段跳读，只读取APP1(EXIF)和SOF段的内容
+    if (!file.seek(2))
+        return;
+
+    for (int segment = 0; segment < kMaxJpegSegments; ++segment) {
+        uchar marker[4];
+        if (file.read(reinterpret_cast<char *>(marker), 4) != 4 || marker[0] != 0xFF)
+            return;
+
+        const uchar type = marker[1];
+        const int length = be16(marker + 2) - 2;
+        if (type == 0xD9 || type == 0xDA || length < 0)
+            return;  // 图像数据开始或文件结束
+
+        const bool isSof = type >= 0xC0 && type <= 0xCF
+                           && type != 0xC4 && type != 0xC8 && type != 0xCC;
+        if (isSof) {
+            const QByteArray sof = file.read(5);
+            if (sof.size() == 5) {
+                const uchar *s = reinterpret_cast<const uchar *>(sof.constData());
+                meta->height = be16(s + 1);
+                meta->width = be16(s + 3);
+            }
+            return;
+        }
+
+        if (type == 0xE1) {
+            const QByteArray app1 = file.read(length);
+            if (app1.startsWith(QByteArray("Exif\0\0", 6)))
+                readExif(app1.mid(6), meta);
+            continue;
+        }
+
+        if (!file.seek(file.pos() + length))
+            return;
+    }
+}
+
+void MetadataService::readExif(const QByteArray &tiff, FileMetadata *meta)
+{
+    const uchar *p = reinterpret_cast<const uchar *>(tiff.constData());
+    const quint32 n = quint32(tiff.size());
+    if (n < 8)
+        return;
+
+    const bool little = p[0] == 'I' && p[1] == 'I';
+    auto rd16 = [&](quint32 off) -> quint32 { return off + 2 <= n ? (little ? le16(p + off) : be16(p + off)) : 0; };
+    auto rd32 = [&](quint32 off) -> quint32 { return off + 4 <= n ? (little ? le32(p + off) : be32(p + off)) : 0; };
+
+    if (rd16(2) != 42)
+        return;
+
+    auto readAscii = [&](quint32 entry) -> QString {
+        const quint32 count = rd32(entry + 4);
+        const quint32 offset = count <= 4 ? entry + 8 : rd32(entry + 8);
+        if (count == 0 || offset >= n || count > n - offset)
+            return QString();
+        return QString::fromLatin1(reinterpret_cast<const char *>(p + offset), int(count)).trimmed()
+            .remove(QChar('\0'));
+    };
+
+    QString make;
+    QString model;
+    quint32 exifIfd = 0;
+
+    const quint32 ifd0 = rd32(4);
+    const quint32 count0 = rd16(ifd0);
+    for (quint32 i = 0; i < count0; ++i) {
+        const quint32 entry = ifd0 + 2 + i * 12;
+        switch (rd16(entry)) {
+        case 0x010F: make = readAscii(entry); break;
+        case 0x0110: model = readAscii(entry); break;
+        case 0x8769: exifIfd = rd32(entry + 8); break;
+        default: break;
+        }
+    }
+
+    if (exifIfd) {
+        const quint32 count = rd16(exifIfd);
+        for (quint32 i = 0; i < count; ++i) {
+            const quint32 entry = exifIfd + 2 + i * 12;
+            if (rd16(entry) == 0x9003) {
+                meta->dateTaken = readAscii(entry);
+                break;
+            }
+        }
+    }
+
+    // 型号里通常已包含厂商名
+    meta->cameraModel = model.startsWith(make) ? model : (make + ' ' + model).trimmed();
+}
+
+void MetadataService::readWavHeader(const QByteArray &header, FileMetadata *meta)
+{
+    if (header.size() < 12 || !header.startsWith("RIFF") || header.mid(8, 4) != "WAVE")
+        return;
+
+    const uchar *p = reinterpret_cast<const uchar *>(header.constData());
+    quint32 byteRate = 0;
+    qint64 offset = 12;
+    while (offset + 8 <= header.size()) {
+        const QByteArray id = header.mid(int(offset), 4);
+        const quint32 chunkSize = le32(p + offset + 4);
+        if (id == "fmt " && offset + 20 <= header.size()) {
+            byteRate = le32(p + offset + 16);
+        } else if (id == "data") {
+            if (byteRate > 0)
+                meta->durationSeconds = double(chunkSize) / byteRate;
+            return;
+        }
+        // 块大小来自文件内容，超出已读头部时不再继续
+        const qint64 next = offset + 8 + qint64(chunkSize) + (chunkSize & 1);
+        if (next > header.size())
+            return;
+        offset = next;
+    }
+}
+
+void MetadataService::readText(QFile &file, const QByteArray &header, FileMetadata *meta)
+{
+    if (header.startsWith("\xEF\xBB\xBF")) {
+        meta->textEncoding = QStringLiteral("UTF-8 BOM");
+    } else if (header.startsWith("\xFF\xFE")) {
+        meta->textEncoding = QStringLiteral("UTF-16LE");
+        return;
+    } else if (header.startsWith("\xFE\xFF")) {
+        meta->textEncoding = QStringLiteral("UTF-16BE");
+        return;
+    } else if (header.contains('\0')) {
+        return;  // 二进制文件
+    } else {
+        bool ascii = false;
+        const bool utf8 = isValidUtf8(reinterpret_cast<const uchar *>(header.constData()),
+                                      header.size(), &ascii);
+        meta->textEncoding = ascii ? QStringLiteral("ASCII")
+                                   : (utf8 ? QStringLiteral("UTF-8") : QStringLiteral("ANSI"));
+    }
+
+    // 行数需要完整读取，通过内存映射统计换行符
+    const qint64 size = file.size();
+    if (size == 0) {
+        meta->lineCount = 0;
+        return;
+    }
+    if (size > kMaxLineCountBytes)
+        return;
+
+    if (uchar *data = file.map(0, size)) {
+        const char *begin = reinterpret_cast<const char *>(data);
+        qint64 lines = std::count(begin, begin + size, '\n');
+        if (begin[size - 1] != '\n')
+            ++lines;
+        meta->lineCount = lines;
+        file.unmap(data);
+    }
+}
@@ -0,0 +1,220 @@
+/**
+ * @file QuickOpenDialog.cpp
+ * @brief 快速打开对话框实现
+ */
+
+#include "QuickOpenDialog.h"
+#include "ui_QuickOpenDialog.h"
+#include <QDebug>
+#include <QDir>
+#include <QDirIterator>
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QKeyEvent>
+#include <QShowEvent>
+
+namespace {
+
+const int kResultLimit = 100;        // 最多显示的结果数
+const int kIndexBatchSize = 4096;    // 索引线程每批发送的路径数
+
+} // namespace
+
+QuickOpenDialog::QuickOpenDialog(QWidget *parent)
+    : QDialog(parent)
+    , ui(new Ui::QuickOpenDialog())
+    , m_indexCancelled(false)
+    , m_indexGeneration(0)
+    , m_indexing(false)
+    , m_lastMatchMs(0.0)
+    , m_retranslatePending(false)
+{
+    ui->setupUi(this);
+
+    ui->queryEdit->installEventFilter(this);
+
+    connect(ui->queryEdit, &QLineEdit::textChanged, this, &QuickOpenDialog::onQueryChanged);
+    connect(ui->resultList, &QListWidget::itemActivated, this, &QuickOpenDialog::onItemActivated);
+    connect(this, &QuickOpenDialog::pathsIndexed, this, &QuickOpenDialog::onPathsIndexed);
+    connect(this, &QuickOpenDialog::indexFinished, this, &QuickOpenDialog::onIndexFinished);
+}
+
+QuickOpenDialog::~QuickOpenDialog()
+{
+    stopIndexing();
+    delete ui;
+}
+
+void QuickOpenDialog::setRootPath(const QString &rootPath)
+{
+    if (rootPath == m_rootPath)
+        return;
+
+    m_rootPath = rootPath;
+    setWindowTitle(tr("快速打开 - %1").arg(QDir::toNativeSeparators(rootPath)));
+    startIndexing();
+}
+
+void QuickOpenDialog::changeEvent(QEvent *event)
+{
+    if (event->type() == QEvent::LanguageChange) {
+        // 对话框隐藏时只做标记
+        if (isVisible())
+            retranslate();
+        else
+            m_retranslatePending = true;
+    }
+    QDialog::changeEvent(event);
+}
+
+void QuickOpenDialog::showEvent(QShowEvent *event)
+{
+    if (m_retranslatePending) {
+        m_retranslatePending = false;
+        retranslate();
+    }
+    QDialog::showEvent(event);
+    ui->queryEdit->setFocus();
+    ui->queryEdit->selectAll();
+}
+
+void QuickOpenDialog::retranslate()
+{
+    ui->retranslateUi(this);
+    if (!m_rootPath.isEmpty())
+        setWindowTitle(tr("快速打开 - %1").arg(QDir::toNativeSeparators(m_rootPath)));
+    updateStatus();
+}
+
+bool QuickOpenDialog::eventFilter(QObject *watched, QEvent *event)
+{
+    // 在输入框中用上下键选择结果，回车打开
+    if (watched == ui->queryEdit && event->type() == QEvent::KeyPress) {
+        QKeyEvent *keyEvent = static_cast<QKeyEvent *>(event);
+        const int row = ui->resultList->currentRow();
+        switch (keyEvent->key()) {
+        case Qt::Key_Down:
+            ui->resultList->setCurrentRow(qMin(row + 1, ui->resultList->count() - 1));
+            return true;
+        case Qt::Key_Up:
+            ui->resultList->setCurrentRow(qMax(row - 1, 0));
+            return true;
+        case Qt::Key_Return:
+        case Qt::Key_Enter:
+            if (QListWidgetItem *item = ui->resultList->currentItem())
+                onItemActivated(item);
+            return true;
+        default:
+            break;
+        }
+    }
+    return QDialog::eventFilter(watched, event);
+}
+
+void QuickOpenDialog::startIndexing()
+{
+    stopIndexing();
+
+    m_matcher.clear();
+    ui->resultList->clear();
+    m_indexCancelled = false;
+    m_indexing = true;
+
+    const int generation = ++m_indexGeneration;
+    const QString rootPath = m_rootPath;
+
+    m_indexThread = std::thread([this, generation, rootPath]() {
+        QDir root(rootPath);
+        QDirIterator it(rootPath, QDir::AllEntries | QDir::NoDotAndDotDot,
+                        QDirIterator::Subdirectories);
+        QStringList batch;
+        while (it.hasNext() && !m_indexCancelled.load()) {
+            batch.append(root.relativeFilePath(it.next()));
+            if (batch.size() >= kIndexBatchSize) {
+                emit pathsIndexed(generation, batch);
+                batch.clear();
+            }
+        }
+        if (!batch.isEmpty())
+            emit pathsIndexed(generation, batch);
+        emit indexFinished(generation);
+    });
+
+    updateStatus();
+}
+
+void QuickOpenDialog::stopIndexing()
+{
+    m_indexCancelled = true;
+    if (m_indexThread.joinable())
+        m_indexThread.join();
+    m_indexing = false;
+}
+
+void QuickOpenDialog::onPathsIndexed(int generation, const QStringList &paths)
+{
+    if (generation != m_indexGeneration)
+        return;  // 旧索引的残留批次
+
+    m_matcher.addPaths(paths);
+
+    // 同一查询再次匹配时只会扫描新增路径
+    if (!ui->queryEdit->text().isEmpty())
+        refreshResults();
+    updateStatus();
+}
+
+void QuickOpenDialog::onIndexFinished(int generation)
+{
+    if (generation != m_indexGeneration)
+        return;
+
+    m_indexing = false;
+    qDebug() << "快速打开索引完成:" << m_matcher.size() << "条路径";
+    updateStatus();
+}
+
+void QuickOpenDialog::onQueryChanged(const QString &text)
+{
+    Q_UNUSED(text)
+    refreshResults();
+    updateStatus();
+}
+
+void QuickOpenDialog::refreshResults()
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    const QVector<FuzzyMatcher::Match> matches =
+        m_matcher.match(ui->queryEdit->text().trimmed(), kResultLimit);
+
+    ui->resultList->setUpdatesEnabled(false);
+    ui->resultList->clear();
+    for (const FuzzyMatcher::Match &match : matches) {
+        const QString relativePath = m_matcher.path(match.index);
+        QListWidgetItem *item = new QListWidgetItem(QDir::toNativeSeparators(relativePath));
+        item->setData(Qt::UserRole, QDir(m_rootPath).filePath(relativePath));
+        ui->resultList->addItem(item);
+    }
+    if (ui->resultList->count() > 0)
+        ui->resultList->setCurrentRow(0);
+    ui->resultList->setUpdatesEnabled(true);
+
+    m_lastMatchMs = timer.nsecsElapsed() / 1.0e6;
+}
+
+void QuickOpenDialog::updateStatus()
+{
+    ui->statusLabel->setText(tr("%1路径: %2 | 结果: %3 | 耗时: %4 ms")
+                             .arg(m_indexing ? tr("正在索引... ") : QString())
+                             .arg(m_matcher.size())
+                             .arg(ui->resultList->count())
+                             .arg(m_lastMatchMs, 0, 'f', 1));
+}
+
+void QuickOpenDialog::onItemActivated(QListWidgetItem *item)
+{
+    emit pathChosen(item->data(Qt::UserRole).toString());
+    accept();
+}
@@ -0,0 +1,136 @@
+/**
+ * @file RenamePreviewModel.cpp
+ * @brief 批量重命名预览模型实现
+ */
+
+#include "RenamePreviewModel.h"
+#include <QBrush>
+#include <QColor>
+#include <QElapsedTimer>
+#include <QTimer>
+
+namespace {
+
+const int kScanBudgetMs = 8;       // 每段检查的时间预算，留出余量给界面绘制
+const int kScanCheckEvery = 256;   // 每处理若干行检查一次时间
+
+} // namespace
+
+RenamePreviewModel::RenamePreviewModel(QObject *parent)
+    : QAbstractListModel(parent)
+    , m_scanTimer(new QTimer(this))
+    , m_scanRow(0)
+    , m_changedCount(0)
+    , m_conflictCount(0)
+{
+    m_rule.compile();
+    m_scanTimer->setInterval(0);
+    connect(m_scanTimer, &QTimer::timeout, this, &RenamePreviewModel::scanChunk);
+}
+
+void RenamePreviewModel::setFiles(const QStringList &names)
+{
+    beginResetModel();
+    m_names = names;
+    endResetModel();
+    restartScan();
+}
+
+void RenamePreviewModel::setRule(const RenameRule &rule)
+{
+    // 行数不变，只需通知可见行重新取数据
+    m_rule = rule;
+    if (!m_names.isEmpty())
+        emit dataChanged(index(0), index(m_names.size() - 1));
+    restartScan();
+}
+
+bool RenamePreviewModel::isScanning() const
+{
+    return m_scanTimer->isActive();
+}
+
+void RenamePreviewModel::restartScan()
+{
+    m_flags.fill(Unchecked, m_names.size());
+    m_seen.clear();
+    m_seen.reserve(m_names.size());
+    m_scanRow = 0;
+    m_changedCount = 0;
+    m_conflictCount = 0;
+    m_scanTimer->start();
+}
+
+void RenamePreviewModel::scanChunk()
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    while (m_scanRow < m_names.size()) {
+        const int row = m_scanRow++;
+        const QString target = m_rule.apply(m_names[row], row);
+        quint8 flags = Checked;
+        if (target != m_names[row])
+            ++m_changedCount;
+        if (!RenameRule::isValidFileName(target))
+            flags |= Invalid;
+
+        // 未改名的项也占用名称，参与重名检查；与执行时使用相同的比较方式
+        const QString key = RenameRule::nameKey(target);
+        const auto it = m_seen.constFind(key);
+        if (it == m_seen.constEnd()) {
+            m_seen.insert(key, row);
+        } else {
+            flags |= Conflict;
+            if (!(m_flags[it.value()] & (Conflict | Invalid)))
+                ++m_conflictCount;
+            m_flags[it.value()] |= Conflict;
+        }
+        if (flags & (Conflict | Invalid))
+            ++m_conflictCount;
+        m_flags[row] = flags;
+
+        if (m_scanRow % kScanCheckEvery == 0 && timer.elapsed() >= kScanBudgetMs)
+            return;
+    }
+
+    m_scanTimer->stop();
+    m_seen.clear();
+    m_seen.squeeze();
+    if (!m_names.isEmpty())
+        emit dataChanged(index(0), index(m_names.size() - 1), { Qt::ForegroundRole, Qt::ToolTipRole });
+    emit scanFinished(m_changedCount, m_conflictCount);
+}
+
+int RenamePreviewModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_names.size();
+}
+
+QVariant RenamePreviewModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_names.size())
+        return QVariant();
+
+    const int row = index.row();
+    const quint8 flags = m_flags.value(row, Unchecked);
+
+    if (role == Qt::DisplayRole) {
+        const QString &name = m_names[row];
+        const QString target = m_rule.apply(name, row);
+        if (target == name)
+            return tr("%1    （不变）").arg(name);
+        return tr("%1    →    %2").arg(name, target);
+    } else if (role == Qt::ForegroundRole) {
+        if (flags & (Conflict | Invalid))
+            return QBrush(QColor("#c0392b"));
+        if (m_rule.apply(m_names[row], row) == m_names[row])
+            return QBrush(QColor("#7f8c8d"));
+    } else if (role == Qt::ToolTipRole) {
+        if (flags & Invalid)
+            return tr("新名称无效");
+        if (flags & Conflict)
+            return tr("与选中的其他项重名");
+    }
+    return QVariant();
+}
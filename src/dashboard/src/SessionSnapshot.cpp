@@ -0,0 +1,89 @@
+/**
+ * @file SessionSnapshot.cpp
+ * @brief 启动快照实现
+ */
+
+#include "SessionSnapshot.h"
+#include <QDataStream>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+namespace {
+
+const quint32 kSnapshotMagic = 0x534E4150;   // "SNAP"
+const quint32 kSnapshotVersion = 1;
+
+} // namespace
+
+SessionSnapshot &SessionSnapshot::current()
+{
+    static SessionSnapshot snapshot;
+    static bool loaded = false;
+    if (!loaded) {
+        snapshot.load();
+        loaded = true;
+    }
+    return snapshot;
+}
+
+QString SessionSnapshot::filePath()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/session.snapshot";
+}
+
+void SessionSnapshot::load()
+{
+    QFile file(filePath());
+    if (!file.open(QIODevice::ReadOnly))
+        return;
+
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_0);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    in >> magic >> version;
+    if (magic != kSnapshotMagic || version != kSnapshotVersion)
+        return;
+
+    qint32 page = 0;
+    quint32 count = 0;
+    in >> lastPath >> page >> expandedPaths >> count;
+    navPage = page;
+
+    entries.clear();
+    entries.reserve(int(count));
+    for (quint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i) {
+        SnapshotEntry entry;
+        in >> entry.name >> entry.isDir >> entry.size >> entry.modified;
+        entries.append(entry);
+    }
+
+    if (in.status() != QDataStream::Ok) {
+        qDebug() << "启动快照已损坏，已忽略";
+        *this = SessionSnapshot();
+    }
+}
+
+bool SessionSnapshot::save() const
+{
+    const QString path = filePath();
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_0);
+    out << kSnapshotMagic << kSnapshotVersion
+        << lastPath << qint32(navPage) << expandedPaths << quint32(entries.size());
+    for (const SnapshotEntry &entry : entries)
+        out << entry.name << entry.isDir << entry.size << entry.modified;
+
+    return file.commit();
+}
@@ -0,0 +1,273 @@
+/**
+ * @file SizeTree.cpp
+ * @brief 磁盘占用聚合树实现
+ */
+
+#include "SizeTree.h"
+#include <QDir>
+#include <algorithm>
+
+namespace {
+
+const quint32 kNodeBlockShift = 16;                     // 每块65536个节点
+const quint32 kNodeBlockSize = 1u << kNodeBlockShift;
+const quint32 kNameBlockShift = 20;                     // 每块1MB名称
+const quint32 kNameBlockSize = 1u << kNameBlockShift;
+
+#ifdef Q_OS_WIN
+const Qt::CaseSensitivity kPathCase = Qt::CaseInsensitive;
+#else
+const Qt::CaseSensitivity kPathCase = Qt::CaseSensitive;
+#endif
+
+} // namespace
+
+SizeTree::SizeTree()
+    : m_nodeCount(0)
+    , m_nameUsed(0)
+{
+}
+
+SizeTree::~SizeTree()
+{
+}
+
+void SizeTree::reset(const QString &rootPath)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_rootPath = QDir::cleanPath(rootPath);
+    m_nodeBlocks.clear();
+    m_nameBlocks.clear();
+    m_nodeCount = 0;
+    m_nameUsed = 0;
+
+    const quint32 root = allocNode();
+    Node &n = node(root);
+    n.flags = DirFlag;
+    n.nameOffset = storeName(m_rootPath.toUtf8());
+    n.nameLength = quint16(qMin<qint64>(m_rootPath.toUtf8().size(), 0xFFFF));
+}
+
+QString SizeTree::rootPath() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_rootPath;
+}
+
+bool SizeTree::isEmpty() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_nodeCount == 0;
+}
+
+SizeTree::Node &SizeTree::node(quint32 index)
+{
+    return m_nodeBlocks[index >> kNodeBlockShift][index & (kNodeBlockSize - 1)];
+}
+
+const SizeTree::Node &SizeTree::node(quint32 index) const
+{
+    return m_nodeBlocks[index >> kNodeBlockShift][index & (kNodeBlockSize - 1)];
+}
+
+quint32 SizeTree::allocNode()
+{
+    if ((m_nodeCount & (kNodeBlockSize - 1)) == 0)
+        m_nodeBlocks.emplace_back(new Node[kNodeBlockSize]);
+
+    const quint32 index = m_nodeCount++;
+    Node &n = node(index);
+    n.size = 0;
+    n.parent = InvalidNode;
+    n.firstChild = InvalidNode;
+    n.nextSibling = InvalidNode;
+    n.nameOffset = 0;
+    n.nameLength = 0;
+    n.flags = 0;
+    return index;
+}
+
+quint32 SizeTree::storeName(const QByteArray &utf8)
+{
+    const quint32 length = quint32(qMin<qint64>(utf8.size(), 0xFFFF));
+    const quint32 used = m_nameUsed & (kNameBlockSize - 1);
+
+    // 名称不跨块存放，当前块放不下时从下一块开始
+    if (used + length > kNameBlockSize)
+        m_nameUsed += kNameBlockSize - used;
+    if ((m_nameUsed >> kNameBlockShift) >= m_nameBlocks.size())
+        m_nameBlocks.emplace_back(new char[kNameBlockSize]);
+
+    const quint32 offset = m_nameUsed;
+    std::copy(utf8.constData(), utf8.constData() + length,
+              m_nameBlocks[offset >> kNameBlockShift].get() + (offset & (kNameBlockSize - 1)));
+    m_nameUsed += length;
+    return offset;
+}
+
+std::vector<quint32> SizeTree::addChildren(quint32 dir, const std::vector<Entry> &entries)
+{
+    // 在锁外完成编码转换，缩短持锁时间
+    std::vector<QByteArray> names;
+    names.reserve(entries.size());
+    quint64 filesSize = 0;
+    for (const Entry &entry : entries) {
+        names.push_back(entry.name.toUtf8());
+        filesSize += entry.size;
+    }
+
+    std::vector<quint32> subdirs;
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const quint32 child = allocNode();
+        Node &n = node(child);
+        n.size = entries[i].size;
+        n.parent = dir;
+        n.nameOffset = storeName(names[i]);
+        n.nameLength = quint16(qMin<qint64>(names[i].size(), 0xFFFF));
+        n.flags = entries[i].isDir ? DirFlag : 0;
+
+        Node &d = node(dir);
+        n.nextSibling = d.firstChild;
+        d.firstChild = child;
+
+        if (entries[i].isDir)
+            subdirs.push_back(child);
+    }
+
+    // 文件大小沿父链向上累加
+    for (quint32 p = dir; p != InvalidNode; p = node(p).parent)
+        node(p).size += filesSize;
+
+    return subdirs;
+}
+
+std::vector<SizeTree::Child> SizeTree::children(quint32 index) const
+{
+    std::vector<Child> result;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (index >= m_nodeCount)
+            return result;
+        for (quint32 c = node(index).firstChild; c != InvalidNode; c = node(c).nextSibling) {
+            const Node &n = node(c);
+            result.push_back({ c, n.size, (n.flags & DirFlag) != 0 });
+        }
+    }
+
+    std::sort(result.begin(), result.end(), [](const Child &a, const Child &b) {
+        return a.size > b.size;
+    });
+    return result;
+}
+
+quint64 SizeTree::size(quint32 index) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return index < m_nodeCount ? node(index).size : 0;
+}
+
+bool SizeTree::isDir(quint32 index) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return index < m_nodeCount && (node(index).flags & DirFlag) != 0;
+}
+
+quint32 SizeTree::parent(quint32 index) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return index < m_nodeCount ? node(index).parent : InvalidNode;
+}
+
+QString SizeTree::nameLocked(quint32 index) const
+{
+    const Node &n = node(index);
+    const char *data = m_nameBlocks[n.nameOffset >> kNameBlockShift].get()
+                       + (n.nameOffset & (kNameBlockSize - 1));
+    return QString::fromUtf8(data, n.nameLength);
+}
+
+QString SizeTree::name(quint32 index) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return index < m_nodeCount ? nameLocked(index) : QString();
+}
+
+QString SizeTree::pathLocked(quint32 index) const
+{
+    QStringList parts;
+    for (quint32 p = index; p != InvalidNode && p != 0; p = node(p).parent)
+        parts.prepend(nameLocked(p));
+
+    if (parts.isEmpty())
+        return m_rootPath;
+    return m_rootPath.endsWith('/') ? m_rootPath + parts.join('/')
+                                    : m_rootPath + '/' + parts.join('/');
+}
+
+QString SizeTree::path(quint32 index) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return index < m_nodeCount ? pathLocked(index) : QString();
+}
+
+quint32 SizeTree::find(const QString &path) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_nodeCount == 0)
+        return InvalidNode;
+
+    const QString cleaned = QDir::cleanPath(path);
+    if (cleaned.compare(m_rootPath, kPathCase) == 0)
+        return 0;
+
+    const QString prefix = m_rootPath.endsWith('/') ? m_rootPath : m_rootPath + '/';
+    if (!cleaned.startsWith(prefix, kPathCase))
+        return InvalidNode;
+
+    quint32 current = 0;
+    const QStringList parts = cleaned.mid(prefix.size()).split('/');
+    for (const QString &part : parts) {
+        quint32 match = InvalidNode;
+        for (quint32 c = node(current).firstChild; c != InvalidNode; c = node(c).nextSibling) {
+            if (nameLocked(c).compare(part, kPathCase) == 0) {
+                match = c;
+                break;
+            }
+        }
+        if (match == InvalidNode)
+            return InvalidNode;
+        current = match;
+    }
+    return current;
+}
+
+void SizeTree::countChildren(quint32 index, int *dirs, int *files) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    *dirs = 0;
+    *files = 0;
+    if (index >= m_nodeCount)
+        return;
+    for (quint32 c = node(index).firstChild; c != InvalidNode; c = node(c).nextSibling) {
+        if (node(c).flags & DirFlag)
+            ++*dirs;
+        else
+            ++*files;
+    }
+}
+
+quint32 SizeTree::nodeCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_nodeCount;
+}
+
+quint64 SizeTree::memoryUsage() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return quint64(m_nodeBlocks.size()) * kNodeBlockSize * sizeof(Node)
+           + quint64(m_nameBlocks.size()) * kNameBlockSize;
+}
@@ -0,0 +1,240 @@
+/**
+ * @file TreemapWidget.cpp
+ * @brief 磁盘占用矩形树图实现
+ */
+
+#include "TreemapWidget.h"
+#include <QMouseEvent>
+#include <QPainter>
+#include <QToolTip>
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+const int kMaxDepth = 3;              // 从当前根节点起最多布局的层数
+const double kHeaderHeight = 16.0;    // 目录块顶部留给名称的高度
+const double kMinNestedSide = 40.0;   // 目录块小于该尺寸时不再展开子项
+const double kMinTileArea = 6.0;      // 小于该面积的子项不再绘制
+
+QString formatSize(quint64 size)
+{
+    const char *units[] = { "B", "KB", "MB", "GB", "TB" };
+    int unitIndex = 0;
+    double value = double(size);
+    while (value >= 1024.0 && unitIndex < 4) {
+        value /= 1024.0;
+        ++unitIndex;
+    }
+    return QString("%1 %2").arg(value, 0, 'f', 2).arg(units[unitIndex]);
+}
+
+// 最差长宽比，用于决定一行放多少个块
+double worstRatio(double rowArea, double minArea, double maxArea, double side)
+{
+    const double side2 = side * side;
+    const double row2 = rowArea * rowArea;
+    return std::max(side2 * maxArea / row2, row2 / (side2 * minArea));
+}
+
+QColor tileColor(quint32 node, int depth, bool isDir)
+{
+    if (!isDir)
+        return QColor(189, 195, 199);
+    const int hue = int((node * 2654435761u) % 360u);
+    return QColor::fromHsv(hue, 90 + depth * 30, 230 - depth * 20);
+}
+
+} // namespace
+
+TreemapWidget::TreemapWidget(QWidget *parent)
+    : QWidget(parent)
+    , m_tree(nullptr)
+    , m_rootNode(0)
+    , m_layoutDirty(true)
+{
+    setMouseTracking(true);
+    setMinimumSize(200, 150);
+}
+
+void TreemapWidget::setTree(const SizeTree *tree)
+{
+    m_tree = tree;
+    m_rootNode = 0;
+    invalidateLayout();
+}
+
+void TreemapWidget::setRootNode(quint32 node)
+{
+    if (node == SizeTree::InvalidNode || node == m_rootNode)
+        return;
+    m_rootNode = node;
+    invalidateLayout();
+}
+
+void TreemapWidget::invalidateLayout()
+{
+    m_layoutDirty = true;
+    update();
+}
+
+void TreemapWidget::resizeEvent(QResizeEvent *event)
+{
+    QWidget::resizeEvent(event);
+    m_layoutDirty = true;
+}
+
+void TreemapWidget::layoutTiles()
+{
+    m_tiles.clear();
+    m_layoutDirty = false;
+    if (!m_tree || m_tree->isEmpty())
+        return;
+
+    layoutChildren(m_rootNode, QRectF(rect()).adjusted(1, 1, -1, -1), 0);
+}
+
+void TreemapWidget::layoutChildren(quint32 node, const QRectF &rect, int depth)
+{
+    if (depth >= kMaxDepth)
+        return;
+    squarify(m_tree->children(node), rect, depth);
+}
+
+void TreemapWidget::squarify(const std::vector<SizeTree::Child> &items, QRectF rect, int depth)
+{
+    // items已按大小降序排列
+    double total = 0.0;
+    for (const SizeTree::Child &item : items)
+        total += double(item.size);
+    if (total <= 0.0 || rect.width() < 1.0 || rect.height() < 1.0)
+        return;
+
+    const double scale = rect.width() * rect.height() / total;
+    size_t i = 0;
+
+    while (i < items.size() && rect.width() >= 1.0 && rect.height() >= 1.0) {
+        const double side = std::min(rect.width(), rect.height());
+        const double maxArea = double(items[i].size) * scale;
+        if (maxArea < kMinTileArea)
+            break;  // 其余子项都太小，留作父块背景
+
+        size_t j = i;
+        double rowArea = 0.0;
+        double worst = std::numeric_limits<double>::max();
+        while (j < items.size()) {
+            const double area = double(items[j].size) * scale;
+            if (area < kMinTileArea)
+                break;
+            const double candidate = worstRatio(rowArea + area, area, maxArea, side);
+            if (j > i && candidate > worst)
+                break;
+            rowArea += area;
+            worst = candidate;
+            ++j;
+        }
+
+        const double thickness = rowArea / side;
+        double offset = 0.0;
+        for (size_t k = i; k < j; ++k) {
+            const double length = double(items[k].size) * scale / thickness;
+            if (rect.width() >= rect.height()) {
+                placeTile(items[k], QRectF(rect.left(), rect.top() + offset, thickness, length), depth);
+            } else {
+                placeTile(items[k], QRectF(rect.left() + offset, rect.top(), length, thickness), depth);
+            }
+            offset += length;
+        }
+
+        if (rect.width() >= rect.height())
+            rect.setLeft(rect.left() + thickness);
+        else
+            rect.setTop(rect.top() + thickness);
+        i = j;
+    }
+}
+
+void TreemapWidget::placeTile(const SizeTree::Child &item, const QRectF &rect, int depth)
+{
+    m_tiles.push_back({ rect, item.node, depth, item.isDir });
+
+    if (item.isDir && rect.width() >= kMinNestedSide && rect.height() >= kMinNestedSide)
+        layoutChildren(item.node, rect.adjusted(2, kHeaderHeight, -2, -2), depth + 1);
+}
+
+void TreemapWidget::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event)
+
+    if (m_layoutDirty)
+        layoutTiles();
+
+    QPainter painter(this);
+    painter.fillRect(rect(), QColor(236, 240, 241));
+
+    if (m_tiles.empty()) {
+        painter.setPen(QColor(127, 140, 141));
+        painter.drawText(rect(), Qt::AlignCenter, tr("暂无数据"));
+        return;
+    }
+
+    const QFontMetrics metrics(font());
+    for (const Tile &tile : m_tiles) {
+        painter.setPen(QColor(44, 62, 80, 120));
+        painter.setBrush(tileColor(tile.node, tile.depth, tile.isDir));
+        painter.drawRect(tile.rect);
+
+        // 空间足够时绘制名称
+        if (tile.rect.width() > 40 && tile.rect.height() > metrics.height()) {
+            const QRectF textRect = tile.rect.adjusted(3, 1, -3, 0);
+            const QString text = metrics.elidedText(m_tree->name(tile.node), Qt::ElideRight,
+                                                    int(textRect.width()));
+            painter.setPen(QColor(44, 62, 80));
+            painter.drawText(textRect, Qt::AlignLeft | Qt::AlignTop, text);
+        }
+    }
+}
+
+int TreemapWidget::tileAt(const QPointF &pos) const
+{
+    // 子块在父块之后加入，倒序查找得到最深的块
+    for (int i = int(m_tiles.size()) - 1; i >= 0; --i) {
+        if (m_tiles[size_t(i)].rect.contains(pos))
+            return i;
+    }
+    return -1;
+}
+
+void TreemapWidget::mousePressEvent(QMouseEvent *event)
+{
+    if (!m_tree)
+        return;
+
+    if (event->button() == Qt::RightButton) {
+        const quint32 parent = m_tree->parent(m_rootNode);
+        if (parent != SizeTree::InvalidNode)
+            emit nodeActivated(parent);
+        return;
+    }
+
+    const int index = tileAt(event->pos());
+    if (index < 0)
+        return;
+
+    const Tile &tile = m_tiles[size_t(index)];
+    emit nodeActivated(tile.isDir ? tile.node : m_tree->parent(tile.node));
+}
+
+void TreemapWidget::mouseMoveEvent(QMouseEvent *event)
+{
+    const int index = tileAt(event->pos());
+    if (index < 0 || !m_tree) {
+        QToolTip::hideText();
+        return;
+    }
+
+    const quint32 node = m_tiles[size_t(index)].node;
+    QToolTip::showText(event->globalPos(),
+                       QString("%1\n%2").arg(m_tree->path(node), formatSize(m_tree->size(node))),
+                       this);
+}
@@ -17,6 +17,8 @@ QT_END_NAMESPACE
 
 namespace mainui {
 
+struct LaunchRequest;
+
 class MainWindow : public QMainWindow
 {
     Q_OBJECT
@@ -25,11 +27,19 @@ public:
     explicit MainWindow(QWidget *parent = nullptr);
     ~MainWindow();
 
+    // 处理启动参数（本进程的命令行或其他实例转交的请求），并把窗口带到前台
+    void handleLaunchRequest(const LaunchRequest &request);
+
+protected:
+    void closeEvent(QCloseEvent *event) override;
+    void changeEvent(QEvent *event) override;
+
 private slots:
     void onNavChanged(int index);
 
 private:
     void setupNavigation();  // 设置导航菜单
+    void retranslate();      // 语言切换后更新窗口标题和导航文字
 
 private:
     Ui::MainWindow *ui;
@@ -0,0 +1,66 @@
+/**
+ * @file SingleInstance.h
+ * @brief 单实例 - 通过本地套接字把再次启动的参数交给已运行的实例
+ */
+
+#ifndef SINGLEINSTANCE_H
+#define SINGLEINSTANCE_H
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+
+class QLocalServer;
+
+namespace mainui {
+
+/**
+ * 命令行中的启动请求
+ *   MultiPageDemo [路径] [--page files|preferences|calculator|序号] [--new-instance]
+ */
+struct LaunchRequest
+{
+    QString path;          // 要打开的目录或文件（绝对路径），为空表示不跳转
+    int page = -1;         // 要显示的页面序号，-1表示不切换
+    bool newInstance = false;
+
+    static LaunchRequest fromArguments(const QStringList &arguments);
+    QStringList toArguments() const;
+};
+
+/**
+ * 单实例服务
+ * 首个实例监听本地套接字（Unix域套接字/命名管道）；之后的启动先尝试连接，
+ * 发送参数并等到对方确认后即可退出，无需创建QApplication和任何页面。
+ */
+class SingleInstance : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit SingleInstance(QObject *parent = nullptr);
+    ~SingleInstance();
+
+    // 把参数交给已运行的实例，对方确认收到时返回true
+    // clientStartMs 为本进程启动时刻（自纪元起的毫秒数），用于统计交接耗时
+    static bool sendToRunning(const QStringList &arguments, qint64 clientStartMs);
+
+    // 开始监听，失败时通过error返回原因；已有实例在监听时不会清理它的套接字
+    bool listen(QString *error = nullptr);
+
+signals:
+    void messageReceived(const QStringList &arguments, qint64 clientStartMs);
+
+private slots:
+    void onNewConnection();
+
+private:
+    static QString serverName();
+
+private:
+    QLocalServer *m_server;
+};
+
+} // namespace mainui
+
+#endif // SINGLEINSTANCE_H
@@ -8,6 +8,9 @@
 
 #include "MainWindow.h"
 #include "ui_MainWindow.h"
+#include "SessionSnapshot.h"
+#include "SingleInstance.h"
+#include <QCloseEvent>
 #include <QDebug>
 
 namespace mainui {
@@ -18,7 +21,6 @@ MainWindow::MainWindow(QWidget *parent)
 {
     ui->setupUi(this);
     
-    setWindowTitle(tr("多页面示例 - Widget提升版"));
     resize(1200, 800);
     
     // 设置导航菜单
@@ -28,8 +30,9 @@ MainWindow::MainWindow(QWidget *parent)
     connect(ui->navList, &QListWidget::currentRowChanged,
             this, &MainWindow::onNavChanged);
     
-    // 默认选中第一个
-    ui->navList->setCurrentRow(0);
+    // 恢复上次的页面，没有快照时选中第一个
+    const int page = SessionSnapshot::current().navPage;
+    ui->navList->setCurrentRow(page >= 0 && page < ui->stackedWidget->count() ? page : 0);
     
     qDebug() << "主窗口创建完成";
 }
@@ -39,17 +42,67 @@ MainWindow::~MainWindow()
     delete ui;
 }
 
+void MainWindow::handleLaunchRequest(const LaunchRequest &request)
+{
+    if (!request.path.isEmpty()) {
+        ui->navList->setCurrentRow(0);
+        ui->fileManagerPage->openPath(request.path);
+    }
+    if (request.page >= 0 && request.page < ui->stackedWidget->count())
+        ui->navList->setCurrentRow(request.page);
+    
+    // 最小化时先恢复，再提到前台
+    setWindowState((windowState() & ~Qt::WindowMinimized) | Qt::WindowActive);
+    show();
+    raise();
+    activateWindow();
+}
+
+void MainWindow::closeEvent(QCloseEvent *event)
+{
+    // 保存启动快照，下次启动时立即恢复
+    SessionSnapshot &snapshot = SessionSnapshot::current();
+    ui->fileManagerPage->saveSnapshot(&snapshot);
+    snapshot.navPage = ui->navList->currentRow();
+    snapshot.save();
+    
+    QMainWindow::closeEvent(event);
+}
+
 void MainWindow::setupNavigation()
 {
     // ============================================
     // 添加导航菜单项（与UI文件中的页面顺序对应）
+    // 文字在 retranslate() 中设置，语言切换时复用同一处
     // ============================================
-    ui->navList->addItem(tr("📁 文件管理"));    // 对应 stackedWidget 第0页
-    ui->navList->addItem(tr("⚙️ 首选项"));      // 对应 stackedWidget 第1页
-    ui->navList->addItem(tr("🧮 计算器"));      // 对应 stackedWidget 第2页
+    for (int i = 0; i < ui->stackedWidget->count(); ++i)
+        ui->navList->addItem(QString());
     
-    // 添加新页面时，在这里添加对应的导航项
-    // ui->navList->addItem(tr("新页面"));
+    retranslate();
+}
+
+void MainWindow::retranslate()
+{
+    setWindowTitle(tr("多页面示例 - Widget提升版"));
+    
+    const QStringList names = {
+        tr("📁 文件管理"),    // 对应 stackedWidget 第0页
+        tr("⚙️ 首选项"),      // 对应 stackedWidget 第1页
+        tr("🧮 计算器")       // 对应 stackedWidget 第2页
+        // 添加新页面时，在这里添加对应的导航项
+    };
+    for (int i = 0; i < names.size() && i < ui->navList->count(); ++i)
+        ui->navList->item(i)->setText(names.at(i));
+}
+
+void MainWindow::changeEvent(QEvent *event)
+{
+    // 主窗口只更新自身的文字，各页面自行处理（隐藏的页面延迟到显示时）
+    if (event->type() == QEvent::LanguageChange) {
+        ui->retranslateUi(this);
+        retranslate();
+    }
+    QMainWindow::changeEvent(event);
 }
 
 void MainWindow::onNavChanged(int index)
@@ -0,0 +1,165 @@
+/**
+ * @file SingleInstance.cpp
+ * @brief 单实例实现
+ */
+
+#include "SingleInstance.h"
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFileInfo>
+#include <QLocalServer>
+#include <QLocalSocket>
+
+namespace mainui {
+
+namespace {
+
+const quint32 kMagic = 0x4D504431;   // "MPD1"
+const char kAck = 'K';
+const int kConnectTimeoutMs = 200;   // 没有实例在运行时连接会立即失败，超时只针对忙碌的实例
+const int kAckTimeoutMs = 1000;
+
+const char *const kPageNames[] = { "files", "preferences", "calculator" };
+
+} // namespace
+
+LaunchRequest LaunchRequest::fromArguments(const QStringList &arguments)
+{
+    LaunchRequest request;
+    for (int i = 0; i < arguments.size(); ++i) {
+        const QString &arg = arguments.at(i);
+        if (arg == QLatin1String("--new-instance")) {
+            request.newInstance = true;
+        } else if (arg == QLatin1String("--page") && i + 1 < arguments.size()) {
+            const QString name = arguments.at(++i).toLower();
+            bool ok = false;
+            const int index = name.toInt(&ok);
+            if (ok) {
+                request.page = index;
+                continue;
+            }
+            for (int p = 0; p < int(sizeof(kPageNames) / sizeof(kPageNames[0])); ++p) {
+                if (name == QLatin1String(kPageNames[p]))
+                    request.page = p;
+            }
+        } else if (!arg.startsWith(QLatin1String("--")) && request.path.isEmpty()) {
+            // 相对路径按本进程的工作目录解析，交给其他实例时已是绝对路径
+            request.path = QDir::cleanPath(QFileInfo(arg).absoluteFilePath());
+        }
+    }
+    return request;
+}
+
+QStringList LaunchRequest::toArguments() const
+{
+    QStringList arguments;
+    if (!path.isEmpty())
+        arguments << path;
+    if (page >= 0)
+        arguments << QStringLiteral("--page") << QString::number(page);
+    return arguments;
+}
+
+SingleInstance::SingleInstance(QObject *parent)
+    : QObject(parent)
+    , m_server(new QLocalServer(this))
+{
+    connect(m_server, &QLocalServer::newConnection, this, &SingleInstance::onNewConnection);
+}
+
+SingleInstance::~SingleInstance()
+{
+}
+
+QString SingleInstance::serverName()
+{
+    // 按用户区分，避免不同用户的实例互相接管；取哈希使套接字路径足够短
+    QByteArray user = qgetenv("USER");
+    if (user.isEmpty())
+        user = qgetenv("USERNAME");
+    const QByteArray key = QCoreApplication::applicationName().toUtf8() + '/' + user;
+    return QStringLiteral("MultiPageDemo-")
+           + QString::fromLatin1(QCryptographicHash::hash(key, QCryptographicHash::Sha1).toHex().left(16));
+}
+
+bool SingleInstance::sendToRunning(const QStringList &arguments, qint64 clientStartMs)
+{
+    QLocalSocket socket;
+    socket.connectToServer(serverName());
+    if (!socket.waitForConnected(kConnectTimeoutMs))
+        return false;
+
+    QByteArray message;
+    QDataStream out(&message, QIODevice::WriteOnly);
+    out.setVersion(QDataStream::Qt_5_0);
+    out << kMagic << clientStartMs << arguments;
+    socket.write(message);
+    if (!socket.waitForBytesWritten(kAckTimeoutMs))
+        return false;
+
+    // 等待对方确认，防止对方在读取前退出导致请求丢失
+    if (!socket.waitForReadyRead(kAckTimeoutMs))
+        return false;
+    char ack = 0;
+    const bool ok = socket.read(&ack, 1) == 1 && ack == kAck;
+    socket.disconnectFromServer();
+    return ok;
+}
+
+bool SingleInstance::listen(QString *error)
+{
+    m_server->setSocketOptions(QLocalServer::UserAccessOption);
+    if (m_server->listen(serverName()))
+        return true;
+
+    // 名称被占用时重新探测一次：探测期间可能有实例刚刚启动，只有连接不上时
+    // 才是上次异常退出遗留的套接字文件，清理后重试
+    if (m_server->serverError() == QAbstractSocket::AddressInUseError) {
+        QLocalSocket probe;
+        probe.connectToServer(serverName());
+        if (probe.waitForConnected(kConnectTimeoutMs)) {
+            probe.disconnectFromServer();
+            if (error)
+                *error = tr("已有实例在运行");
+            return false;
+        }
+        QLocalServer::removeServer(serverName());
+        if (m_server->listen(serverName()))
+            return true;
+    }
+
+    if (error)
+        *error = m_server->errorString();
+    return false;
+}
+
+void SingleInstance::onNewConnection()
+{
+    while (QLocalSocket *socket = m_server->nextPendingConnection()) {
+        connect(socket, &QLocalSocket::disconnected, socket, &QObject::deleteLater);
+        connect(socket, &QLocalSocket::readyRead, this, [this, socket]() {
+            // 消息可能分多次到达，数据不完整时回滚等待下一次readyRead
+            QDataStream in(socket);
+            in.setVersion(QDataStream::Qt_5_0);
+            in.startTransaction();
+            quint32 magic = 0;
+            qint64 clientStartMs = 0;
+            QStringList arguments;
+            in >> magic >> clientStartMs >> arguments;
+            if (!in.commitTransaction())
+                return;
+
+            if (magic != kMagic) {
+                socket->abort();
+                return;
+            }
+            socket->write(&kAck, 1);
+            socket->flush();
+            emit messageReceived(arguments, clientStartMs);
+        });
+    }
+}
+
+} // namespace mainui
@@ -14,6 +14,9 @@ QT_BEGIN_NAMESPACE
 namespace Ui { class SecondWindow; }  // 使用现有的SecondWindow.ui
 QT_END_NAMESPACE
 
+class PlotDialog;
+class MatrixStatsDialog;
+
 /**
  * 计算器页面类
  * 包装SecondWindow.ui作为主界面的子页面
@@ -29,6 +32,10 @@ public:
     // 获取页面名称（用于导航显示）
     static QString pageName() { return QObject::tr("计算器"); }
 
+protected:
+    void changeEvent(QEvent *event) override;
+    void showEvent(QShowEvent *event) override;
+
 private slots:
     // 数字按钮点击
     void onDigitClicked();
@@ -46,11 +53,16 @@ private slots:
     void onPlusMinusClicked();
     // 百分号按钮点击
     void onPercentClicked();
+    // 打开函数绘图
+    void onPlotClicked();
+    // 打开矩阵/统计
+    void onMatrixClicked();
 
 private:
     void setupConnections();  // 设置信号连接
     void updateDisplay();     // 更新显示
     void calculate();         // 执行计算
+    void retranslate();       // 语言切换后重新翻译界面
 
 private:
     Ui::SecondWindow *ui;  // 复用SecondWindow的UI
@@ -60,6 +72,10 @@ private:
     QString pendingOperator;   // 待执行的运算符
     double leftOperand;        // 左操作数
     bool waitingForOperand;    // 是否在等待新操作数
+
+    PlotDialog *m_plotDialog;  // 函数绘图（首次使用时创建）
+    MatrixStatsDialog *m_matrixDialog;  // 矩阵/统计（首次使用时创建）
+    bool m_retranslatePending;          // 隐藏时收到语言切换，下次显示时再翻译
 };
 
 #endif // CALCULATORPAGE_H
@@ -0,0 +1,57 @@
+/**
+ * @file Expression.h
+ * @brief 单变量表达式 - 编译为后缀指令序列，可在多线程中并发求值
+ */
+
+#ifndef EXPRESSION_H
+#define EXPRESSION_H
+
+#include <QString>
+#include <vector>
+
+/**
+ * 单变量(x)表达式
+ * 支持 + - * / ^（含 × ÷）、括号、隐式乘法(2x)、常量 pi/e
+ * 以及 sin cos tan asin acos atan sqrt abs exp ln log floor ceil 函数。
+ * 编译后只读，evaluate()可在多个线程中同时调用。
+ */
+class Expression
+{
+public:
+    Expression();
+
+    // 编译失败时返回false并给出错误信息
+    bool compile(const QString &text, QString *error);
+    bool isValid() const { return !m_code.empty(); }
+    QString text() const { return m_text; }
+
+    double evaluate(double x) const;
+
+private:
+    enum OpCode {
+        PushConst,
+        PushX,
+        Add,
+        Sub,
+        Mul,
+        Div,
+        Pow,
+        Neg,
+        Call
+    };
+
+    struct Instruction
+    {
+        OpCode op;
+        double value;
+        double (*func)(double);
+    };
+
+    class Parser;
+
+    QString m_text;
+    std::vector<Instruction> m_code;
+    int m_maxStack;
+};
+
+#endif // EXPRESSION_H
@@ -0,0 +1,63 @@
+/**
+ * @file FunctionPlotWidget.h
+ * @brief 函数曲线绘图控件 - 支持拖动平移和滚轮缩放
+ */
+
+#ifndef FUNCTIONPLOTWIDGET_H
+#define FUNCTIONPLOTWIDGET_H
+
+#include "Expression.h"
+#include <QPolygonF>
+#include <QWidget>
+#include <memory>
+#include <vector>
+
+class PlotSampler;
+
+/**
+ * 函数曲线绘图控件
+ * 采样由PlotSampler完成（分块缓存，平移缩放时复用）；
+ * 绘制前按像素列做最小/最大值抽取，每列最多保留4个点，绘制开销只与控件宽度有关。
+ */
+class FunctionPlotWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit FunctionPlotWidget(QWidget *parent = nullptr);
+    ~FunctionPlotWidget();
+
+    void setExpression(const Expression &expression);
+    void resetView();
+
+signals:
+    // 每次重绘后报告采样统计（点数、求值次数、耗时）
+    void statsChanged(const QString &text);
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void mouseReleaseEvent(QMouseEvent *event) override;
+    void wheelEvent(QWheelEvent *event) override;
+
+private:
+    QPointF toScreen(double x, double y) const;
+    double toWorldX(double px) const;
+    double toWorldY(double py) const;
+    void zoomAt(const QPointF &pos, double factor);
+
+    void drawGrid(QPainter &painter);
+    std::vector<QPolygonF> decimate(const std::vector<QPointF> &points) const;
+
+private:
+    std::unique_ptr<PlotSampler> m_sampler;
+    double m_xMin;
+    double m_xMax;
+    double m_yMin;
+    double m_yMax;
+    bool m_dragging;
+    QPoint m_lastDragPos;
+};
+
+#endif // FUNCTIONPLOTWIDGET_H
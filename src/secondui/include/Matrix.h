@@ -0,0 +1,53 @@
+/**
+ * @file Matrix.h
+ * @brief 稠密矩阵及线性代数运算（分块乘法、LU分解求解与求逆）
+ */
+
+#ifndef MATRIX_H
+#define MATRIX_H
+
+#include <vector>
+
+/**
+ * 行主序稠密矩阵
+ * 乘法按缓存分块计算，最内层为连续内存上的SIMD累加，外层按行块分给多个线程；
+ * 求解与求逆基于部分选主元的LU分解。
+ */
+class Matrix
+{
+public:
+    Matrix();
+    Matrix(int rows, int cols);
+
+    static Matrix identity(int n);
+    static Matrix random(int rows, int cols, unsigned seed);
+
+    int rows() const { return m_rows; }
+    int cols() const { return m_cols; }
+    bool isEmpty() const { return m_rows == 0 || m_cols == 0; }
+
+    double &at(int row, int col) { return m_data[size_t(row) * m_cols + col]; }
+    double at(int row, int col) const { return m_data[size_t(row) * m_cols + col]; }
+    double *row(int r) { return m_data.data() + size_t(r) * m_cols; }
+    const double *row(int r) const { return m_data.data() + size_t(r) * m_cols; }
+
+    // 调用者负责保证维度匹配（a.cols() == b.rows()）
+    static Matrix multiply(const Matrix &a, const Matrix &b);
+
+    // 求解 a * x = b，a为方阵；a奇异时返回false
+    static bool solve(const Matrix &a, const Matrix &b, Matrix *x);
+    static bool inverse(const Matrix &a, Matrix *result);
+
+private:
+    // LU分解（原地），perm记录行交换；奇异时返回false
+    static bool decompose(Matrix *lu, std::vector<int> *perm);
+    // 用已分解的LU就地求解多个右端项（b的每一列）
+    static void substitute(const Matrix &lu, Matrix *b);
+
+private:
+    int m_rows;
+    int m_cols;
+    std::vector<double> m_data;
+};
+
+#endif // MATRIX_H
@@ -0,0 +1,73 @@
+/**
+ * @file MatrixStatsDialog.h
+ * @brief 矩阵/统计对话框 - 矩阵乘法、求逆、解方程组及数据集描述统计
+ */
+
+#ifndef MATRIXSTATSDIALOG_H
+#define MATRIXSTATSDIALOG_H
+
+#include <QDialog>
+#include <atomic>
+#include <functional>
+#include <thread>
+#include "Matrix.h"
+
+QT_BEGIN_NAMESPACE
+namespace Ui { class MatrixStatsDialog; }
+QT_END_NAMESPACE
+
+class QPlainTextEdit;
+
+/**
+ * 矩阵/统计对话框
+ * 计算在后台线程中执行，同一时间只运行一个任务，结果通过信号回到界面线程
+ */
+class MatrixStatsDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit MatrixStatsDialog(QWidget *parent = nullptr);
+    ~MatrixStatsDialog();
+
+signals:
+    // 后台线程 -> 界面线程
+    void taskFinished(const QString &result, const QString &status);
+
+protected:
+    void changeEvent(QEvent *event) override;
+    void showEvent(QShowEvent *event) override;
+
+private slots:
+    void onMultiplyClicked();
+    void onInverseClicked();
+    void onSolveClicked();
+    void onRandomClicked();
+    void onComputeStatsClicked();
+    void onLoadFileClicked();
+    void onCancelClicked();
+    void onTaskFinished(const QString &result, const QString &status);
+
+private:
+    // 取得输入矩阵：随机生成的直接使用，否则解析文本
+    bool operandA(Matrix *matrix);
+    bool operandB(Matrix *matrix);
+
+    // 在后台执行task，结果写入target
+    void runTask(QPlainTextEdit *target, const std::function<QString(QString *status)> &task);
+    void setBusy(bool busy);
+    void retranslate();           // 语言切换后重新翻译界面
+
+private:
+    Ui::MatrixStatsDialog *ui;
+
+    Matrix m_randomA;          // 随机填充的矩阵（对应文本框被编辑后作废）
+    Matrix m_randomB;
+
+    std::thread m_worker;
+    std::atomic<bool> m_cancelled;   // 每次开始任务时清除，由取消按钮或析构设置
+    QPlainTextEdit *m_taskTarget;
+    bool m_retranslatePending;    // 隐藏时收到语言切换，下次显示时再翻译
+};
+
+#endif // MATRIXSTATSDIALOG_H
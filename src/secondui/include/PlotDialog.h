@@ -0,0 +1,42 @@
+/**
+ * @file PlotDialog.h
+ * @brief 函数绘图对话框 - 输入单变量表达式并绘制曲线
+ */
+
+#ifndef PLOTDIALOG_H
+#define PLOTDIALOG_H
+
+#include <QDialog>
+
+QT_BEGIN_NAMESPACE
+namespace Ui { class PlotDialog; }
+QT_END_NAMESPACE
+
+/**
+ * 函数绘图对话框
+ * 表达式编译后交给FunctionPlotWidget绘制
+ */
+class PlotDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit PlotDialog(QWidget *parent = nullptr);
+    ~PlotDialog();
+
+protected:
+    void changeEvent(QEvent *event) override;
+    void showEvent(QShowEvent *event) override;
+
+private slots:
+    void onPlotClicked();
+
+private:
+    void retranslate();           // 语言切换后重新翻译界面
+
+private:
+    Ui::PlotDialog *ui;
+    bool m_retranslatePending;    // 隐藏时收到语言切换，下次显示时再翻译
+};
+
+#endif // PLOTDIALOG_H
@@ -0,0 +1,56 @@
+/**
+ * @file PlotSampler.h
+ * @brief 函数采样器 - 多线程自适应采样与多分辨率分块缓存
+ */
+
+#ifndef PLOTSAMPLER_H
+#define PLOTSAMPLER_H
+
+#include "Expression.h"
+#include <QPointF>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <vector>
+
+/**
+ * 函数采样器
+ * x轴按2的幂划分为多级分块：第level级分块宽度为2^level，
+ * 视图跨度决定使用的级别，因此平移和小幅缩放时可直接复用已采样的分块。
+ * 每个分块先均匀采样，再按曲率和不连续点递归细分，缺失的分块并行计算。
+ * 结果中y为NaN的点表示曲线在此断开（渐近线、定义域外）。
+ */
+class PlotSampler
+{
+public:
+    explicit PlotSampler(const Expression &expression);
+
+    // 返回覆盖[xMin, xMax]的采样点（按x递增）
+    std::vector<QPointF> sample(double xMin, double xMax);
+
+    quint64 evaluationCount() const { return m_evaluations.load(); }
+    int cachedTileCount() const { return int(m_tiles.size()); }
+
+private:
+    using Tile = std::vector<QPointF>;
+    using TileKey = std::pair<int, qint64>;   // (级别, 序号)
+
+    struct CachedTile
+    {
+        std::shared_ptr<const Tile> points;
+        quint64 lastUsed;
+    };
+
+    std::shared_ptr<const Tile> computeTile(int level, qint64 index) const;
+    void refine(double x0, double y0, double x1, double y1, int depth,
+                double tolerance, double jump, Tile *out, quint64 *evaluations) const;
+    void evictTiles();
+
+private:
+    Expression m_expression;
+    std::map<TileKey, CachedTile> m_tiles;
+    quint64 m_useCounter;
+    mutable std::atomic<quint64> m_evaluations;
+};
+
+#endif // PLOTSAMPLER_H
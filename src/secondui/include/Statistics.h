@@ -0,0 +1,92 @@
+/**
+ * @file Statistics.h
+ * @brief 单遍流式统计 - Welford均值/方差与P²分位数估计
+ */
+
+#ifndef STATISTICS_H
+#define STATISTICS_H
+
+#include <cstdint>
+
+/**
+ * 单遍累计均值、方差、极值（Welford算法，数值稳定，不保存数据）
+ */
+class RunningStats
+{
+public:
+    RunningStats();
+
+    void add(double value);
+
+    int64_t count() const { return m_count; }
+    double mean() const { return m_mean; }
+    double variance() const;         // 样本方差（n-1）
+    double standardDeviation() const;
+    double min() const { return m_min; }
+    double max() const { return m_max; }
+    double sum() const { return m_mean * double(m_count); }
+
+private:
+    int64_t m_count;
+    double m_mean;
+    double m_m2;
+    double m_min;
+    double m_max;
+};
+
+/**
+ * P²分位数估计（Jain & Chlamtac）
+ * 只维护5个标记点，O(1)内存逐个更新；前5个值之前返回精确结果
+ */
+class P2Quantile
+{
+public:
+    explicit P2Quantile(double p);
+
+    void add(double value);
+    double value() const;
+
+private:
+    double parabolic(int i, double d) const;
+    double linear(int i, int d) const;
+
+private:
+    double m_p;
+    int64_t m_count;
+    double m_heights[5];     // 标记点高度（估计值）
+    double m_positions[5];   // 标记点实际位置
+    double m_desired[5];     // 标记点期望位置
+    double m_increments[5];  // 每个新值的期望位置增量
+};
+
+/**
+ * 数据集统计：一遍扫描同时得到描述统计和四个常用分位数
+ */
+class DatasetStatistics
+{
+public:
+    DatasetStatistics();
+
+    void add(double value);
+
+    // 解析文本中的数字（以空白、逗号、分号分隔）逐个累计，返回无法识别的片段数
+    int64_t addText(const char *begin, const char *end);
+
+    const RunningStats &summary() const { return m_stats; }
+    double q1() const { return m_q1.value(); }
+    double median() const { return m_median.value(); }
+    double q3() const { return m_q3.value(); }
+    double p95() const { return m_p95.value(); }
+
+    // 解析[begin, end)中的一个十进制数（可带符号、小数点、指数），完整匹配才返回true
+    static bool parseNumber(const char *begin, const char *end, double *value);
+
+private:
+    RunningStats m_stats;
+    P2Quantile m_q1;
+    P2Quantile m_median;
+    P2Quantile m_q3;
+    P2Quantile m_p95;
+};
+
+#endif // STATISTICS_H
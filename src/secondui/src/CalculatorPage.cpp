@@ -5,7 +5,11 @@
 
 #include "CalculatorPage.h"
 #include "ui_SecondWindow.h"  // 使用SecondWindow的生成头文件
+#include "PlotDialog.h"
+#include "MatrixStatsDialog.h"
 #include <QDebug>
+#include <QEvent>
+#include <QShowEvent>
 #include <cmath>
 
 CalculatorPage::CalculatorPage(QWidget *parent)
@@ -13,6 +17,9 @@ CalculatorPage::CalculatorPage(QWidget *parent)
     , ui(new Ui::SecondWindow())
     , leftOperand(0.0)
     , waitingForOperand(false)
+    , m_plotDialog(nullptr)
+    , m_matrixDialog(nullptr)
+    , m_retranslatePending(false)
 {
     ui->setupUi(this);
     
@@ -58,6 +65,10 @@ void CalculatorPage::setupConnections()
     connect(ui->dotButton, &QPushButton::clicked, this, &CalculatorPage::onDotClicked);
     connect(ui->plusMinusButton, &QPushButton::clicked, this, &CalculatorPage::onPlusMinusClicked);
     connect(ui->percentButton, &QPushButton::clicked, this, &CalculatorPage::onPercentClicked);
+
+    // 工具按钮
+    connect(ui->plotButton, &QPushButton::clicked, this, &CalculatorPage::onPlotClicked);
+    connect(ui->matrixButton, &QPushButton::clicked, this, &CalculatorPage::onMatrixClicked);
 }
 
 void CalculatorPage::onDigitClicked()
@@ -165,6 +176,58 @@ void CalculatorPage::onPercentClicked()
     updateDisplay();
 }
 
+void CalculatorPage::onPlotClicked()
+{
+    if (!m_plotDialog)
+        m_plotDialog = new PlotDialog(this);
+
+    m_plotDialog->show();
+    m_plotDialog->raise();
+    m_plotDialog->activateWindow();
+}
+
+void CalculatorPage::onMatrixClicked()
+{
+    if (!m_matrixDialog)
+        m_matrixDialog = new MatrixStatsDialog(this);
+
+    m_matrixDialog->show();
+    m_matrixDialog->raise();
+    m_matrixDialog->activateWindow();
+}
+
+void CalculatorPage::changeEvent(QEvent *event)
+{
+    if (event->type() == QEvent::LanguageChange) {
+        // 页面不在前台时只做标记
+        if (isVisible())
+            retranslate();
+        else
+            m_retranslatePending = true;
+    }
+    QWidget::changeEvent(event);
+}
+
+void CalculatorPage::showEvent(QShowEvent *event)
+{
+    if (m_retranslatePending) {
+        m_retranslatePending = false;
+        retranslate();
+    }
+    QWidget::showEvent(event);
+}
+
+void CalculatorPage::retranslate()
+{
+    // 保留当前的运算过程和提示，只更新界面上的固定文字
+    const QString operation = ui->operationLabel->text();
+    const QString status = ui->statusLabel->text();
+    ui->retranslateUi(this);
+    ui->operationLabel->setText(operation);
+    ui->statusLabel->setText(status);
+    updateDisplay();
+}
+
 void CalculatorPage::updateDisplay()
 {
     ui->displayEdit->setText(currentInput);
@@ -0,0 +1,301 @@
+/**
+ * @file Expression.cpp
+ * @brief 单变量表达式实现（递归下降解析）
+ */
+
+#include "Expression.h"
+#include <QObject>
+#include <cmath>
+
+namespace {
+
+const int kInlineStack = 64;   // 栈深度不超过该值时使用栈上数组
+const double kPi = 3.14159265358979323846;
+const double kE = 2.71828182845904523536;
+
+double fnSin(double v) { return std::sin(v); }
+double fnCos(double v) { return std::cos(v); }
+double fnTan(double v) { return std::tan(v); }
+double fnAsin(double v) { return std::asin(v); }
+double fnAcos(double v) { return std::acos(v); }
+double fnAtan(double v) { return std::atan(v); }
+double fnSqrt(double v) { return std::sqrt(v); }
+double fnAbs(double v) { return std::fabs(v); }
+double fnExp(double v) { return std::exp(v); }
+double fnLn(double v) { return std::log(v); }
+double fnLog(double v) { return std::log10(v); }
+double fnFloor(double v) { return std::floor(v); }
+double fnCeil(double v) { return std::ceil(v); }
+
+struct FunctionEntry
+{
+    const char *name;
+    double (*func)(double);
+};
+
+const FunctionEntry kFunctions[] = {
+    { "sin", fnSin }, { "cos", fnCos }, { "tan", fnTan },
+    { "asin", fnAsin }, { "acos", fnAcos }, { "atan", fnAtan },
+    { "sqrt", fnSqrt }, { "abs", fnAbs }, { "exp", fnExp },
+    { "ln", fnLn }, { "log", fnLog }, { "floor", fnFloor }, { "ceil", fnCeil }
+};
+
+} // namespace
+
+/**
+ * 递归下降解析器，直接生成后缀指令
+ *   expr    := term (('+'|'-') term)*
+ *   term    := unary (('*'|'/'|隐式) unary)*
+ *   unary   := ('-'|'+') unary | power
+ *   power   := primary ('^' unary)?
+ *   primary := 数字 | x | 常量 | 函数 '(' expr ')' | '(' expr ')'
+ */
+class Expression::Parser
+{
+public:
+    Parser(const QString &text, std::vector<Instruction> *code)
+        : m_text(text), m_pos(0), m_code(code)
+    {
+    }
+
+    bool parse(QString *error)
+    {
+        if (!parseExpr())
+            return fail(error);
+        skipSpaces();
+        if (m_pos < m_text.size()) {
+            m_error = QObject::tr("无法识别的字符: %1").arg(m_text.at(m_pos));
+            return fail(error);
+        }
+        return true;
+    }
+
+private:
+    bool fail(QString *error)
+    {
+        if (error)
+            *error = m_error.isEmpty() ? QObject::tr("表达式不完整") : m_error;
+        return false;
+    }
+
+    void skipSpaces()
+    {
+        while (m_pos < m_text.size() && m_text.at(m_pos).isSpace())
+            ++m_pos;
+    }
+
+    QChar peek()
+    {
+        skipSpaces();
+        return m_pos < m_text.size() ? m_text.at(m_pos) : QChar();
+    }
+
+    void append(OpCode op, double value = 0.0, double (*func)(double) = nullptr)
+    {
+        m_code->push_back({ op, value, func });
+    }
+
+    bool parseExpr()
+    {
+        if (!parseTerm())
+            return false;
+        for (;;) {
+            const QChar c = peek();
+            if (c != '+' && c != '-')
+                return true;
+            ++m_pos;
+            if (!parseTerm())
+                return false;
+            append(c == '+' ? Add : Sub);
+        }
+    }
+
+    bool parseTerm()
+    {
+        if (!parseUnary())
+            return false;
+        for (;;) {
+            const QChar c = peek();
+            OpCode op;
+            if (c == '*' || c == QChar(0x00D7)) {          // ×
+                ++m_pos;
+                op = Mul;
+            } else if (c == '/' || c == QChar(0x00F7)) {   // ÷
+                ++m_pos;
+                op = Div;
+            } else if (c.isLetterOrNumber() || c == '(' || c == '.') {
+                op = Mul;  // 隐式乘法，如 2x、3(x+1)
+            } else {
+                return true;
+            }
+            if (!parseUnary())
+                return false;
+            append(op);
+        }
+    }
+
+    bool parseUnary()
+    {
+        const QChar c = peek();
+        if (c == '-' || c == '+') {
+            ++m_pos;
+            if (!parseUnary())
+                return false;
+            if (c == '-')
+                append(Neg);
+            return true;
+        }
+        return parsePower();
+    }
+
+    bool parsePower()
+    {
+        if (!parsePrimary())
+            return false;
+        if (peek() == '^') {
+            ++m_pos;
+            if (!parseUnary())  // 右结合
+                return false;
+            append(Pow);
+        }
+        return true;
+    }
+
+    bool parsePrimary()
+    {
+        const QChar c = peek();
+        if (c.isDigit() || c == '.') {
+            const int start = m_pos;
+            while (m_pos < m_text.size() && (m_text.at(m_pos).isDigit() || m_text.at(m_pos) == '.'))
+                ++m_pos;
+            // 科学计数法 1e-3
+            if (m_pos < m_text.size() && (m_text.at(m_pos) == 'e' || m_text.at(m_pos) == 'E')
+                && m_pos + 1 < m_text.size()
+                && (m_text.at(m_pos + 1).isDigit() || m_text.at(m_pos + 1) == '-' || m_text.at(m_pos + 1) == '+')) {
+                m_pos += 2;
+                while (m_pos < m_text.size() && m_text.at(m_pos).isDigit())
+                    ++m_pos;
+            }
+            bool ok = false;
+            const double value = m_text.mid(start, m_pos - start).toDouble(&ok);
+            if (!ok) {
+                m_error = QObject::tr("无效的数字: %1").arg(m_text.mid(start, m_pos - start));
+                return false;
+            }
+            append(PushConst, value);
+            return true;
+        }
+
+        if (c.isLetter()) {
+            const int start = m_pos;
+            while (m_pos < m_text.size() && m_text.at(m_pos).isLetter())
+                ++m_pos;
+            const QString name = m_text.mid(start, m_pos - start).toLower();
+
+            if (name == "x") {
+                append(PushX);
+                return true;
+            }
+            if (name == "pi" || name == QString(QChar(0x03C0))) {
+                append(PushConst, kPi);
+                return true;
+            }
+            if (name == "e") {
+                append(PushConst, kE);
+                return true;
+            }
+            for (const FunctionEntry &entry : kFunctions) {
+                if (name == entry.name) {
+                    if (peek() != '(') {
+                        m_error = QObject::tr("函数 %1 后缺少括号").arg(name);
+                        return false;
+                    }
+                    if (!parsePrimary())
+                        return false;
+                    append(Call, 0.0, entry.func);
+                    return true;
+                }
+            }
+            m_error = QObject::tr("未知的名称: %1").arg(name);
+            return false;
+        }
+
+        if (c == '(') {
+            ++m_pos;
+            if (!parseExpr())
+                return false;
+            if (peek() != ')') {
+                m_error = QObject::tr("缺少右括号");
+                return false;
+            }
+            ++m_pos;
+            return true;
+        }
+
+        return false;
+    }
+
+private:
+    QString m_text;
+    int m_pos;
+    std::vector<Instruction> *m_code;
+    QString m_error;
+};
+
+Expression::Expression()
+    : m_maxStack(0)
+{
+}
+
+bool Expression::compile(const QString &text, QString *error)
+{
+    std::vector<Instruction> code;
+    Parser parser(text, &code);
+    if (!parser.parse(error)) {
+        m_code.clear();
+        return false;
+    }
+
+    // 计算求值所需的最大栈深度
+    int depth = 0;
+    int maxDepth = 0;
+    for (const Instruction &ins : code) {
+        if (ins.op == PushConst || ins.op == PushX)
+            ++depth;
+        else if (ins.op != Neg && ins.op != Call)
+            --depth;
+        maxDepth = std::max(maxDepth, depth);
+    }
+
+    m_text = text;
+    m_code.swap(code);
+    m_maxStack = maxDepth;
+    return true;
+}
+
+double Expression::evaluate(double x) const
+{
+    double inlineStack[kInlineStack];
+    std::vector<double> heapStack;
+    double *stack = inlineStack;
+    if (m_maxStack > kInlineStack) {
+        heapStack.resize(size_t(m_maxStack));
+        stack = heapStack.data();
+    }
+
+    int top = -1;
+    for (const Instruction &ins : m_code) {
+        switch (ins.op) {
+        case PushConst: stack[++top] = ins.value; break;
+        case PushX:     stack[++top] = x; break;
+        case Add:       stack[top - 1] += stack[top]; --top; break;
+        case Sub:       stack[top - 1] -= stack[top]; --top; break;
+        case Mul:       stack[top - 1] *= stack[top]; --top; break;
+        case Div:       stack[top - 1] /= stack[top]; --top; break;
+        case Pow:       stack[top - 1] = std::pow(stack[top - 1], stack[top]); --top; break;
+        case Neg:       stack[top] = -stack[top]; break;
+        case Call:      stack[top] = ins.func(stack[top]); break;
+        }
+    }
+    return top == 0 ? stack[0] : std::nan("");
+}
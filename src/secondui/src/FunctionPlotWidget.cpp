@@ -0,0 +1,291 @@
+/**
+ * @file FunctionPlotWidget.cpp
+ * @brief 函数曲线绘图控件实现
+ */
+
+#include "FunctionPlotWidget.h"
+#include "PlotSampler.h"
+#include <QElapsedTimer>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QWheelEvent>
+#include <cmath>
+
+namespace {
+
+const double kDefaultRange = 10.0;     // 默认视图 [-10, 10] x [-10, 10]
+const double kMinSpan = 1e-9;
+const double kMaxSpan = 1e9;
+const double kWheelZoomStep = 1.2;     // 滚轮每格缩放比例
+const double kClampFactor = 10.0;      // 远超视图的y值截断为控件高度的倍数，避免绘制溢出
+
+// 取1/2/5×10^n中与目标间距最接近的网格间距
+double niceStep(double span, int targetLines)
+{
+    const double raw = span / targetLines;
+    const double base = std::pow(10.0, std::floor(std::log10(raw)));
+    const double ratio = raw / base;
+    if (ratio < 1.5)
+        return base;
+    if (ratio < 3.5)
+        return base * 2;
+    if (ratio < 7.5)
+        return base * 5;
+    return base * 10;
+}
+
+} // namespace
+
+FunctionPlotWidget::FunctionPlotWidget(QWidget *parent)
+    : QWidget(parent)
+    , m_xMin(-kDefaultRange)
+    , m_xMax(kDefaultRange)
+    , m_yMin(-kDefaultRange)
+    , m_yMax(kDefaultRange)
+    , m_dragging(false)
+{
+    setMinimumSize(320, 240);
+    setCursor(Qt::OpenHandCursor);
+}
+
+FunctionPlotWidget::~FunctionPlotWidget()
+{
+}
+
+void FunctionPlotWidget::setExpression(const Expression &expression)
+{
+    // 新表达式的采样缓存全部失效
+    m_sampler.reset(new PlotSampler(expression));
+    update();
+}
+
+void FunctionPlotWidget::resetView()
+{
+    m_xMin = -kDefaultRange;
+    m_xMax = kDefaultRange;
+    m_yMin = -kDefaultRange;
+    m_yMax = kDefaultRange;
+    update();
+}
+
+QPointF FunctionPlotWidget::toScreen(double x, double y) const
+{
+    const double sx = (x - m_xMin) / (m_xMax - m_xMin) * width();
+    double sy = (m_yMax - y) / (m_yMax - m_yMin) * height();
+    sy = qBound(-kClampFactor * height(), sy, (kClampFactor + 1) * height());
+    return QPointF(sx, sy);
+}
+
+double FunctionPlotWidget::toWorldX(double px) const
+{
+    return m_xMin + px / width() * (m_xMax - m_xMin);
+}
+
+double FunctionPlotWidget::toWorldY(double py) const
+{
+    return m_yMax - py / height() * (m_yMax - m_yMin);
+}
+
+void FunctionPlotWidget::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event);
+
+    QPainter painter(this);
+    painter.fillRect(rect(), QColor("#1e2b37"));
+    drawGrid(painter);
+
+    if (!m_sampler)
+        return;
+
+    QElapsedTimer timer;
+    timer.start();
+    const quint64 evaluationsBefore = m_sampler->evaluationCount();
+
+    const std::vector<QPointF> points = m_sampler->sample(m_xMin, m_xMax);
+    const std::vector<QPolygonF> runs = decimate(points);
+
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(QPen(QColor("#1abc9c"), 2));
+    int drawn = 0;
+    for (const QPolygonF &run : runs) {
+        painter.drawPolyline(run);
+        drawn += run.size();
+    }
+
+    emit statsChanged(tr("采样点: %1 | 绘制点: %2 | 新增求值: %3 | 缓存分块: %4 | 耗时: %5 ms")
+                          .arg(points.size())
+                          .arg(drawn)
+                          .arg(m_sampler->evaluationCount() - evaluationsBefore)
+                          .arg(m_sampler->cachedTileCount())
+                          .arg(timer.nsecsElapsed() / 1e6, 0, 'f', 2));
+}
+
+void FunctionPlotWidget::drawGrid(QPainter &painter)
+{
+    const double xStep = niceStep(m_xMax - m_xMin, 8);
+    const double yStep = niceStep(m_yMax - m_yMin, 6);
+
+    painter.setPen(QColor("#2c3e50"));
+    for (double x = std::ceil(m_xMin / xStep) * xStep; x <= m_xMax; x += xStep) {
+        const double sx = toScreen(x, 0).x();
+        painter.drawLine(QPointF(sx, 0), QPointF(sx, height()));
+    }
+    for (double y = std::ceil(m_yMin / yStep) * yStep; y <= m_yMax; y += yStep) {
+        const double sy = toScreen(0, y).y();
+        painter.drawLine(QPointF(0, sy), QPointF(width(), sy));
+    }
+
+    // 坐标轴（不在视图内时贴边显示）
+    const QPointF origin = toScreen(0, 0);
+    const double axisX = qBound(0.0, origin.x(), double(width() - 1));
+    const double axisY = qBound(0.0, origin.y(), double(height() - 1));
+    painter.setPen(QColor("#7f8c8d"));
+    painter.drawLine(QPointF(0, axisY), QPointF(width(), axisY));
+    painter.drawLine(QPointF(axisX, 0), QPointF(axisX, height()));
+
+    painter.setPen(QColor("#95a5a6"));
+    for (double x = std::ceil(m_xMin / xStep) * xStep; x <= m_xMax; x += xStep) {
+        if (std::fabs(x) < xStep / 2)
+            continue;
+        painter.drawText(QPointF(toScreen(x, 0).x() + 2, axisY - 2), QString::number(x, 'g', 6));
+    }
+    for (double y = std::ceil(m_yMin / yStep) * yStep; y <= m_yMax; y += yStep) {
+        if (std::fabs(y) < yStep / 2)
+            continue;
+        painter.drawText(QPointF(axisX + 2, toScreen(0, y).y() - 2), QString::number(y, 'g', 6));
+    }
+}
+
+/**
+ * 按像素列抽取：同一列内只保留首点、最小值点、最大值点和末点（按原顺序），
+ * 折线外观与绘制全部点一致。y为NaN的点处断开，返回的每段折线分别绘制。
+ */
+std::vector<QPolygonF> FunctionPlotWidget::decimate(const std::vector<QPointF> &points) const
+{
+    std::vector<QPolygonF> runs;
+    QPolygonF run;
+
+    int column = 0;
+    bool hasBucket = false;
+    QPointF first, last, low, high;
+    int lowIndex = 0;
+    int highIndex = 0;
+
+    auto flushBucket = [&]() {
+        if (!hasBucket)
+            return;
+        run.append(first);
+        if (lowIndex < highIndex) {
+            run.append(low);
+            run.append(high);
+        } else {
+            run.append(high);
+            run.append(low);
+        }
+        run.append(last);
+        hasBucket = false;
+    };
+    auto flushRun = [&]() {
+        flushBucket();
+        if (run.size() > 1)
+            runs.push_back(run);
+        run.clear();
+    };
+
+    for (int i = 0; i < int(points.size()); ++i) {
+        const QPointF &p = points[size_t(i)];
+        if (std::isnan(p.y())) {
+            flushRun();
+            continue;
+        }
+
+        const QPointF s = toScreen(p.x(), p.y());
+        const int col = int(std::floor(s.x()));
+        if (hasBucket && col == column) {
+            last = s;
+            if (s.y() < low.y()) {
+                low = s;
+                lowIndex = i;
+            }
+            if (s.y() > high.y()) {
+                high = s;
+                highIndex = i;
+            }
+            continue;
+        }
+
+        flushBucket();
+        column = col;
+        first = last = low = high = s;
+        lowIndex = highIndex = i;
+        hasBucket = true;
+    }
+    flushRun();
+    return runs;
+}
+
+void FunctionPlotWidget::zoomAt(const QPointF &pos, double factor)
+{
+    const double span = (m_xMax - m_xMin) * factor;
+    if (span < kMinSpan || span > kMaxSpan)
+        return;
+
+    // 保持光标下的坐标不动
+    const double cx = toWorldX(pos.x());
+    const double cy = toWorldY(pos.y());
+    m_xMin = cx + (m_xMin - cx) * factor;
+    m_xMax = cx + (m_xMax - cx) * factor;
+    m_yMin = cy + (m_yMin - cy) * factor;
+    m_yMax = cy + (m_yMax - cy) * factor;
+    update();
+}
+
+void FunctionPlotWidget::mousePressEvent(QMouseEvent *event)
+{
+    if (event->button() == Qt::LeftButton) {
+        m_dragging = true;
+        m_lastDragPos = event->pos();
+        setCursor(Qt::ClosedHandCursor);
+    }
+    QWidget::mousePressEvent(event);
+}
+
+void FunctionPlotWidget::mouseMoveEvent(QMouseEvent *event)
+{
+    if (m_dragging) {
+        const QPoint delta = event->pos() - m_lastDragPos;
+        m_lastDragPos = event->pos();
+        const double dx = delta.x() * (m_xMax - m_xMin) / width();
+        const double dy = delta.y() * (m_yMax - m_yMin) / height();
+        m_xMin -= dx;
+        m_xMax -= dx;
+        m_yMin += dy;
+        m_yMax += dy;
+        update();
+    }
+    QWidget::mouseMoveEvent(event);
+}
+
+void FunctionPlotWidget::mouseReleaseEvent(QMouseEvent *event)
+{
+    if (event->button() == Qt::LeftButton) {
+        m_dragging = false;
+        setCursor(Qt::OpenHandCursor);
+    }
+    QWidget::mouseReleaseEvent(event);
+}
+
+void FunctionPlotWidget::wheelEvent(QWheelEvent *event)
+{
+    const double steps = event->angleDelta().y() / 120.0;
+    if (steps == 0.0)
+        return;
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+    const QPointF pos = event->position();
+#else
+    const QPointF pos = event->posF();
+#endif
+    zoomAt(pos, std::pow(kWheelZoomStep, -steps));
+    event->accept();
+}
@@ -0,0 +1,260 @@
+/**
+ * @file Matrix.cpp
+ * @brief 稠密矩阵运算实现
+ */
+
+#include "Matrix.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MATRIX_USE_SSE2
+#endif
+
+namespace {
+
+// 分块大小：B的一个块(kBlockDepth x kBlockCols)约256KB，可留在L2缓存中
+const int kBlockRows = 32;
+const int kBlockDepth = 128;
+const int kBlockCols = 256;
+const int kPanelWidth = 64;          // LU分解的列面板宽度
+const double kMinParallelWork = 1e6; // 乘加次数低于该值时不开线程
+const double kSingularEpsilon = 1e-14;
+
+// y[0..n) += a * x[0..n)
+inline void axpy(double *y, const double *x, double a, int n)
+{
+    int i = 0;
+#ifdef MATRIX_USE_SSE2
+    const __m128d va = _mm_set1_pd(a);
+    for (; i + 8 <= n; i += 8) {
+        __m128d y0 = _mm_loadu_pd(y + i);
+        __m128d y1 = _mm_loadu_pd(y + i + 2);
+        __m128d y2 = _mm_loadu_pd(y + i + 4);
+        __m128d y3 = _mm_loadu_pd(y + i + 6);
+        y0 = _mm_add_pd(y0, _mm_mul_pd(va, _mm_loadu_pd(x + i)));
+        y1 = _mm_add_pd(y1, _mm_mul_pd(va, _mm_loadu_pd(x + i + 2)));
+        y2 = _mm_add_pd(y2, _mm_mul_pd(va, _mm_loadu_pd(x + i + 4)));
+        y3 = _mm_add_pd(y3, _mm_mul_pd(va, _mm_loadu_pd(x + i + 6)));
+        _mm_storeu_pd(y + i, y0);
+        _mm_storeu_pd(y + i + 2, y1);
+        _mm_storeu_pd(y + i + 4, y2);
+        _mm_storeu_pd(y + i + 6, y3);
+    }
+#endif
+    for (; i < n; ++i)
+        y[i] += a * x[i];
+}
+
+/**
+ * 把[0, count)切分给多个线程执行 fn(begin, end)
+ * work为总工作量估计，过小时直接在当前线程执行
+ */
+template <typename Fn>
+void parallelFor(int count, double work, Fn fn)
+{
+    const int hardware = int(std::max(1u, std::thread::hardware_concurrency()));
+    const int threadCount = work < kMinParallelWork ? 1 : std::min(hardware, count);
+    if (threadCount <= 1) {
+        fn(0, count);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    const int chunk = (count + threadCount - 1) / threadCount;
+    for (int begin = chunk; begin < count; begin += chunk)
+        threads.emplace_back(fn, begin, std::min(count, begin + chunk));
+    fn(0, std::min(count, chunk));
+    for (std::thread &thread : threads)
+        thread.join();
+}
+
+} // namespace
+
+Matrix::Matrix()
+    : m_rows(0)
+    , m_cols(0)
+{
+}
+
+Matrix::Matrix(int rows, int cols)
+    : m_rows(rows)
+    , m_cols(cols)
+    , m_data(size_t(rows) * cols, 0.0)
+{
+}
+
+Matrix Matrix::identity(int n)
+{
+    Matrix m(n, n);
+    for (int i = 0; i < n; ++i)
+        m.at(i, i) = 1.0;
+    return m;
+}
+
+Matrix Matrix::random(int rows, int cols, unsigned seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    Matrix m(rows, cols);
+    for (double &value : m.m_data)
+        value = dist(engine);
+    return m;
+}
+
+Matrix Matrix::multiply(const Matrix &a, const Matrix &b)
+{
+    const int m = a.rows();
+    const int n = b.cols();
+    const int depth = a.cols();
+    Matrix c(m, n);
+
+    // 每个线程负责若干行块，互不重叠，无需同步
+    const int rowBlocks = (m + kBlockRows - 1) / kBlockRows;
+    parallelFor(rowBlocks, double(m) * n * depth, [&](int blockBegin, int blockEnd) {
+        for (int block = blockBegin; block < blockEnd; ++block) {
+            const int i0 = block * kBlockRows;
+            const int i1 = std::min(m, i0 + kBlockRows);
+            for (int k0 = 0; k0 < depth; k0 += kBlockDepth) {
+                const int k1 = std::min(depth, k0 + kBlockDepth);
+                for (int j0 = 0; j0 < n; j0 += kBlockCols) {
+                    const int width = std::min(n, j0 + kBlockCols) - j0;
+                    for (int i = i0; i < i1; ++i) {
+                        double *cRow = c.row(i) + j0;
+                        const double *aRow = a.row(i);
+                        for (int k = k0; k < k1; ++k)
+                            axpy(cRow, b.row(k) + j0, aRow[k], width);
+                    }
+                }
+            }
+        }
+    });
+    return c;
+}
+
+/**
+ * 分块右视LU分解：逐个列面板做选主元消元，
+ * 再用面板结果一次性更新右下方的剩余子矩阵（这一步占绝大部分计算量，按行并行）
+ */
+bool Matrix::decompose(Matrix *lu, std::vector<int> *perm)
+{
+    const int n = lu->rows();
+    perm->resize(size_t(n));
+    for (int i = 0; i < n; ++i)
+        (*perm)[size_t(i)] = i;
+
+    double scale = 0.0;
+    for (double value : lu->m_data)
+        scale = std::max(scale, std::fabs(value));
+    const double tiny = scale * kSingularEpsilon * n;
+    if (scale == 0.0)
+        return false;
+
+    for (int k0 = 0; k0 < n; k0 += kPanelWidth) {
+        const int k1 = std::min(n, k0 + kPanelWidth);
+
+        // 1. 面板内选主元消元（只更新面板内的列）
+        for (int k = k0; k < k1; ++k) {
+            int pivot = k;
+            for (int i = k + 1; i < n; ++i) {
+                if (std::fabs(lu->at(i, k)) > std::fabs(lu->at(pivot, k)))
+                    pivot = i;
+            }
+            if (std::fabs(lu->at(pivot, k)) <= tiny)
+                return false;
+            if (pivot != k) {
+                std::swap_ranges(lu->row(k), lu->row(k) + n, lu->row(pivot));
+                std::swap((*perm)[size_t(k)], (*perm)[size_t(pivot)]);
+            }
+
+            const double *pivotRow = lu->row(k);
+            const double inv = 1.0 / pivotRow[k];
+            for (int i = k + 1; i < n; ++i) {
+                double *r = lu->row(i);
+                const double factor = r[k] * inv;
+                r[k] = factor;
+                axpy(r + k + 1, pivotRow + k + 1, -factor, k1 - k - 1);
+            }
+        }
+
+        if (k1 == n)
+            break;
+
+        // 2. 面板右侧的U块：用单位下三角L11做前代
+        for (int i = k0 + 1; i < k1; ++i) {
+            double *r = lu->row(i);
+            for (int p = k0; p < i; ++p)
+                axpy(r + k1, lu->row(p) + k1, -r[p], n - k1);
+        }
+
+        // 3. 右下子矩阵 A22 -= L21 * U12，按列分块以复用缓存中的U12
+        const int trailing = n - k1;
+        parallelFor(trailing, double(trailing) * trailing * (k1 - k0), [&](int begin, int end) {
+            for (int j0 = k1; j0 < n; j0 += kBlockCols) {
+                const int width = std::min(n, j0 + kBlockCols) - j0;
+                for (int i = k1 + begin; i < k1 + end; ++i) {
+                    double *r = lu->row(i);
+                    for (int p = k0; p < k1; ++p)
+                        axpy(r + j0, lu->row(p) + j0, -r[p], width);
+                }
+            }
+        });
+    }
+    return true;
+}
+
+// 对b的各列求解 L * U * x = b（b已按perm重排），按列块并行
+void Matrix::substitute(const Matrix &lu, Matrix *b)
+{
+    const int n = lu.rows();
+    const int m = b->cols();
+    const int colBlocks = (m + kBlockCols - 1) / kBlockCols;
+
+    parallelFor(colBlocks, double(n) * n * m, [&](int blockBegin, int blockEnd) {
+        const int j0 = blockBegin * kBlockCols;
+        const int width = std::min(m, blockEnd * kBlockCols) - j0;
+
+        // 前代：L为单位下三角
+        for (int i = 1; i < n; ++i) {
+            const double *l = lu.row(i);
+            double *bi = b->row(i) + j0;
+            for (int p = 0; p < i; ++p)
+                axpy(bi, b->row(p) + j0, -l[p], width);
+        }
+
+        // 回代
+        for (int i = n - 1; i >= 0; --i) {
+            const double *u = lu.row(i);
+            double *bi = b->row(i) + j0;
+            for (int p = i + 1; p < n; ++p)
+                axpy(bi, b->row(p) + j0, -u[p], width);
+            const double inv = 1.0 / u[i];
+            for (int j = 0; j < width; ++j)
+                bi[j] *= inv;
+        }
+    });
+}
+
+bool Matrix::solve(const Matrix &a, const Matrix &b, Matrix *x)
+{
+    Matrix lu = a;
+    std::vector<int> perm;
+    if (!decompose(&lu, &perm))
+        return false;
+
+    Matrix result(b.rows(), b.cols());
+    for (int i = 0; i < b.rows(); ++i)
+        std::copy(b.row(perm[size_t(i)]), b.row(perm[size_t(i)]) + b.cols(), result.row(i));
+
+    substitute(lu, &result);
+    *x = result;
+    return true;
+}
+
+bool Matrix::inverse(const Matrix &a, Matrix *result)
+{
+    return solve(a, identity(a.rows()), result);
+}
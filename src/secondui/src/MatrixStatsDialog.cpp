@@ -0,0 +1,427 @@
+/**
+ * @file MatrixStatsDialog.cpp
+ * @brief 矩阵/统计对话框实现
+ */
+
+#include "MatrixStatsDialog.h"
+#include "ui_MatrixStatsDialog.h"
+#include "Statistics.h"
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QFile>
+#include <QFileDialog>
+#include <QFileInfo>
+#include <QShowEvent>
+#include <QSignalBlocker>
+#include <ctime>
+
+namespace {
+
+const int kMaxShownRows = 12;          // 结果中最多显示的行列数，其余以省略号表示
+const int kMaxShownCols = 8;
+const qint64 kFileSliceBytes = 16 * 1024 * 1024;   // 统计文件时每次处理的字节数
+
+inline bool isFieldSeparator(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == ',' || c == ';';
+}
+
+// 每行一行矩阵，行内数字以空白、逗号或分号分隔
+bool parseMatrix(const QString &text, Matrix *matrix, QString *error)
+{
+    std::vector<double> values;
+    int rows = 0;
+    int cols = -1;
+
+    const QStringList lines = text.split('\n');
+    for (const QString &line : lines) {
+        const QByteArray bytes = line.trimmed().toUtf8();
+        if (bytes.isEmpty())
+            continue;
+
+        const char *p = bytes.constData();
+        const char *end = p + bytes.size();
+        int count = 0;
+        while (p < end) {
+            while (p < end && isFieldSeparator(*p))
+                ++p;
+            const char *token = p;
+            while (p < end && !isFieldSeparator(*p))
+                ++p;
+            if (token == p)
+                break;
+
+            double value;
+            if (!DatasetStatistics::parseNumber(token, p, &value)) {
+                *error = QObject::tr("第 %1 行包含无法识别的内容: %2")
+                             .arg(rows + 1).arg(QString::fromUtf8(token, int(p - token)));
+                return false;
+            }
+            values.push_back(value);
+            ++count;
+        }
+
+        if (cols >= 0 && count != cols) {
+            *error = QObject::tr("第 %1 行有 %2 个数，应为 %3 个").arg(rows + 1).arg(count).arg(cols);
+            return false;
+        }
+        cols = count;
+        ++rows;
+    }
+
+    if (rows == 0) {
+        *error = QObject::tr("矩阵为空");
+        return false;
+    }
+
+    Matrix result(rows, cols);
+    for (int r = 0; r < rows; ++r)
+        std::copy(values.begin() + size_t(r) * cols, values.begin() + size_t(r + 1) * cols, result.row(r));
+    *matrix = result;
+    return true;
+}
+
+// 大矩阵只显示左上角
+QString formatMatrix(const Matrix &matrix)
+{
+    QString text = QObject::tr("%1 × %2 矩阵\n").arg(matrix.rows()).arg(matrix.cols());
+    const int rows = qMin(matrix.rows(), kMaxShownRows);
+    const int cols = qMin(matrix.cols(), kMaxShownCols);
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c)
+            text += QString("%1").arg(matrix.at(r, c), 14, 'g', 8);
+        if (cols < matrix.cols())
+            text += QStringLiteral("  …");
+        text += '\n';
+    }
+    if (rows < matrix.rows())
+        text += QStringLiteral("  ⋮\n");
+    return text;
+}
+
+QString formatStatistics(const DatasetStatistics &stats, qint64 skipped)
+{
+    const RunningStats &s = stats.summary();
+    if (s.count() == 0)
+        return QObject::tr("没有可统计的数字");
+
+    QString text;
+    text += QObject::tr("数量:     %1\n").arg(s.count());
+    text += QObject::tr("总和:     %1\n").arg(s.sum(), 0, 'g', 12);
+    text += QObject::tr("均值:     %1\n").arg(s.mean(), 0, 'g', 12);
+    text += QObject::tr("样本方差: %1\n").arg(s.variance(), 0, 'g', 12);
+    text += QObject::tr("标准差:   %1\n").arg(s.standardDeviation(), 0, 'g', 12);
+    text += QObject::tr("最小值:   %1\n").arg(s.min(), 0, 'g', 12);
+    text += QObject::tr("Q1:       %1\n").arg(stats.q1(), 0, 'g', 12);
+    text += QObject::tr("中位数:   %1\n").arg(stats.median(), 0, 'g', 12);
+    text += QObject::tr("Q3:       %1\n").arg(stats.q3(), 0, 'g', 12);
+    text += QObject::tr("P95:      %1\n").arg(stats.p95(), 0, 'g', 12);
+    text += QObject::tr("最大值:   %1\n").arg(s.max(), 0, 'g', 12);
+    text += QObject::tr("\n分位数为单遍P²估计值");
+    if (skipped > 0)
+        text += QObject::tr("\n已跳过 %1 个无法识别的片段").arg(skipped);
+    return text;
+}
+
+QString elapsedText(const QElapsedTimer &timer)
+{
+    return QObject::tr("%1 ms").arg(timer.nsecsElapsed() / 1e6, 0, 'f', 1);
+}
+
+} // namespace
+
+MatrixStatsDialog::MatrixStatsDialog(QWidget *parent)
+    : QDialog(parent)
+    , ui(new Ui::MatrixStatsDialog())
+    , m_cancelled(false)
+    , m_taskTarget(nullptr)
+    , m_retranslatePending(false)
+{
+    ui->setupUi(this);
+
+    connect(ui->multiplyButton, &QPushButton::clicked, this, &MatrixStatsDialog::onMultiplyClicked);
+    connect(ui->inverseButton, &QPushButton::clicked, this, &MatrixStatsDialog::onInverseClicked);
+    connect(ui->solveButton, &QPushButton::clicked, this, &MatrixStatsDialog::onSolveClicked);
+    connect(ui->randomButton, &QPushButton::clicked, this, &MatrixStatsDialog::onRandomClicked);
+    connect(ui->computeStatsButton, &QPushButton::clicked, this, &MatrixStatsDialog::onComputeStatsClicked);
+    connect(ui->loadFileButton, &QPushButton::clicked, this, &MatrixStatsDialog::onLoadFileClicked);
+    connect(ui->cancelButton, &QPushButton::clicked, this, &MatrixStatsDialog::onCancelClicked);
+    connect(this, &MatrixStatsDialog::taskFinished, this, &MatrixStatsDialog::onTaskFinished);
+
+    // 用户编辑文本后，随机矩阵作废
+    connect(ui->matrixAEdit, &QPlainTextEdit::textChanged, this, [this]() { m_randomA = Matrix(); });
+    connect(ui->matrixBEdit, &QPlainTextEdit::textChanged, this, [this]() { m_randomB = Matrix(); });
+}
+
+MatrixStatsDialog::~MatrixStatsDialog()
+{
+    m_cancelled = true;
+    if (m_worker.joinable())
+        m_worker.join();
+    delete ui;
+}
+
+void MatrixStatsDialog::changeEvent(QEvent *event)
+{
+    if (event->type() == QEvent::LanguageChange) {
+        // 对话框隐藏时只做标记
+        if (isVisible())
+            retranslate();
+        else
+            m_retranslatePending = true;
+    }
+    QDialog::changeEvent(event);
+}
+
+void MatrixStatsDialog::showEvent(QShowEvent *event)
+{
+    if (m_retranslatePending) {
+        m_retranslatePending = false;
+        retranslate();
+    }
+    QDialog::showEvent(event);
+}
+
+void MatrixStatsDialog::retranslate()
+{
+    // 状态栏显示的是运行结果，翻译后保留
+    const QString status = ui->statusLabel->text();
+    ui->retranslateUi(this);
+    ui->statusLabel->setText(status);
+}
+
+bool MatrixStatsDialog::operandA(Matrix *matrix)
+{
+    if (!m_randomA.isEmpty()) {
+        *matrix = m_randomA;
+        return true;
+    }
+    QString error;
+    if (!parseMatrix(ui->matrixAEdit->toPlainText(), matrix, &error)) {
+        ui->statusLabel->setText(tr("矩阵 A: %1").arg(error));
+        return false;
+    }
+    return true;
+}
+
+bool MatrixStatsDialog::operandB(Matrix *matrix)
+{
+    if (!m_randomB.isEmpty()) {
+        *matrix = m_randomB;
+        return true;
+    }
+    QString error;
+    if (!parseMatrix(ui->matrixBEdit->toPlainText(), matrix, &error)) {
+        ui->statusLabel->setText(tr("矩阵 B: %1").arg(error));
+        return false;
+    }
+    return true;
+}
+
+void MatrixStatsDialog::onMultiplyClicked()
+{
+    Matrix a, b;
+    if (!operandA(&a) || !operandB(&b))
+        return;
+    if (a.cols() != b.rows()) {
+        ui->statusLabel->setText(tr("维度不匹配: A 为 %1×%2，B 为 %3×%4")
+                                     .arg(a.rows()).arg(a.cols()).arg(b.rows()).arg(b.cols()));
+        return;
+    }
+
+    runTask(ui->matrixResultEdit, [a, b](QString *status) {
+        QElapsedTimer timer;
+        timer.start();
+        const Matrix c = Matrix::multiply(a, b);
+        *status = tr("A × B 用时 %1").arg(elapsedText(timer));
+        return formatMatrix(c);
+    });
+}
+
+void MatrixStatsDialog::onInverseClicked()
+{
+    Matrix a;
+    if (!operandA(&a))
+        return;
+    if (a.rows() != a.cols()) {
+        ui->statusLabel->setText(tr("只有方阵才能求逆"));
+        return;
+    }
+
+    runTask(ui->matrixResultEdit, [a](QString *status) {
+        QElapsedTimer timer;
+        timer.start();
+        Matrix inverse;
+        if (!Matrix::inverse(a, &inverse)) {
+            *status = tr("求逆失败");
+            return tr("矩阵奇异（或接近奇异），不可逆");
+        }
+        *status = tr("A⁻¹ 用时 %1").arg(elapsedText(timer));
+        return formatMatrix(inverse);
+    });
+}
+
+void MatrixStatsDialog::onSolveClicked()
+{
+    Matrix a, b;
+    if (!operandA(&a) || !operandB(&b))
+        return;
+    if (a.rows() != a.cols() || b.rows() != a.rows()) {
+        ui->statusLabel->setText(tr("需要 n×n 的 A 和 n 行的 B"));
+        return;
+    }
+
+    runTask(ui->matrixResultEdit, [a, b](QString *status) {
+        QElapsedTimer timer;
+        timer.start();
+        Matrix x;
+        if (!Matrix::solve(a, b, &x)) {
+            *status = tr("求解失败");
+            return tr("矩阵 A 奇异（或接近奇异），方程组无唯一解");
+        }
+        *status = tr("解 A·X = B 用时 %1").arg(elapsedText(timer));
+        return formatMatrix(x);
+    });
+}
+
+void MatrixStatsDialog::onRandomClicked()
+{
+    const int n = ui->randomSizeSpin->value();
+    const unsigned seed = unsigned(std::time(nullptr));
+    {
+        QSignalBlocker blockA(ui->matrixAEdit);
+        QSignalBlocker blockB(ui->matrixBEdit);
+        ui->matrixAEdit->setPlainText(tr("[随机矩阵 %1×%1]").arg(n));
+        ui->matrixBEdit->setPlainText(tr("[随机矩阵 %1×1]").arg(n));
+    }
+    m_randomA = Matrix::random(n, n, seed);
+    m_randomB = Matrix::random(n, 1, seed + 1);
+    ui->statusLabel->setText(tr("已生成随机矩阵，编辑文本框即可改回手动输入"));
+}
+
+void MatrixStatsDialog::onComputeStatsClicked()
+{
+    const QByteArray data = ui->dataEdit->toPlainText().toUtf8();
+    runTask(ui->statsResultEdit, [data](QString *status) {
+        QElapsedTimer timer;
+        timer.start();
+        DatasetStatistics stats;
+        const qint64 skipped = stats.addText(data.constData(), data.constData() + data.size());
+        *status = tr("统计用时 %1").arg(elapsedText(timer));
+        return formatStatistics(stats, skipped);
+    });
+}
+
+void MatrixStatsDialog::onLoadFileClicked()
+{
+    const QString path = QFileDialog::getOpenFileName(this, tr("选择数据文件"), QString(),
+                                                      tr("文本数据 (*.txt *.csv *.dat);;所有文件 (*)"));
+    if (path.isEmpty())
+        return;
+
+    std::atomic<bool> *cancelled = &m_cancelled;
+    runTask(ui->statsResultEdit, [path, cancelled](QString *status) {
+        QElapsedTimer timer;
+        timer.start();
+
+        QFile file(path);
+        if (!file.open(QIODevice::ReadOnly)) {
+            *status = tr("无法打开文件");
+            return tr("无法打开: %1").arg(path);
+        }
+
+        // 优先内存映射整个文件，按片处理并在分隔符处切开，以便响应取消
+        DatasetStatistics stats;
+        qint64 skipped = 0;
+        const qint64 size = file.size();
+        if (uchar *data = size > 0 ? file.map(0, size) : nullptr) {
+            const char *begin = reinterpret_cast<const char *>(data);
+            qint64 pos = 0;
+            while (pos < size && !cancelled->load()) {
+                qint64 sliceEnd = qMin(size, pos + kFileSliceBytes);
+                while (sliceEnd < size && !isFieldSeparator(begin[sliceEnd]))
+                    ++sliceEnd;
+                skipped += stats.addText(begin + pos, begin + sliceEnd);
+                pos = sliceEnd;
+            }
+            file.unmap(data);
+        } else {
+            QByteArray carry;
+            while (!file.atEnd() && !cancelled->load()) {
+                QByteArray chunk = carry + file.read(kFileSliceBytes);
+                int cut = chunk.size();
+                if (!file.atEnd()) {
+                    while (cut > 0 && !isFieldSeparator(chunk.at(cut - 1)))
+                        --cut;
+                }
+                carry = chunk.mid(cut);
+                skipped += stats.addText(chunk.constData(), chunk.constData() + cut);
+            }
+            skipped += stats.addText(carry.constData(), carry.constData() + carry.size());
+        }
+
+        *status = tr("%1（%2 MB）统计用时 %3")
+                      .arg(QFileInfo(path).fileName())
+                      .arg(size / (1024.0 * 1024.0), 0, 'f', 1)
+                      .arg(elapsedText(timer));
+        return formatStatistics(stats, skipped);
+    });
+    // 只有读取文件按片检查取消，其他任务很快完成
+    ui->cancelButton->setEnabled(true);
+}
+
+void MatrixStatsDialog::onCancelClicked()
+{
+    // 工作线程在下一片开始前退出，结果仍通过taskFinished送达
+    m_cancelled = true;
+    ui->cancelButton->setEnabled(false);
+    ui->statusLabel->setText(tr("正在取消..."));
+}
+
+void MatrixStatsDialog::runTask(QPlainTextEdit *target, const std::function<QString(QString *)> &task)
+{
+    if (m_worker.joinable())
+        m_worker.join();
+
+    m_taskTarget = target;
+    m_cancelled = false;
+    setBusy(true);
+    ui->statusLabel->setText(tr("计算中..."));
+
+    // 析构时会等待线程结束，对象销毁后尚未处理的队列事件随之丢弃
+    m_worker = std::thread([this, task]() {
+        QString status;
+        const QString result = task(&status);
+        emit taskFinished(result, status);
+    });
+}
+
+void MatrixStatsDialog::onTaskFinished(const QString &result, const QString &status)
+{
+    if (m_worker.joinable())
+        m_worker.join();
+
+    // 取消时只得到部分数据，保留上一次的结果
+    if (m_cancelled.load()) {
+        ui->statusLabel->setText(tr("已取消"));
+    } else {
+        if (m_taskTarget)
+            m_taskTarget->setPlainText(result);
+        ui->statusLabel->setText(status);
+    }
+    setBusy(false);
+
+    qDebug() << "矩阵/统计:" << status;
+}
+
+void MatrixStatsDialog::setBusy(bool busy)
+{
+    ui->multiplyButton->setEnabled(!busy);
+    ui->inverseButton->setEnabled(!busy);
+    ui->solveButton->setEnabled(!busy);
+    ui->randomButton->setEnabled(!busy);
+    ui->computeStatsButton->setEnabled(!busy);
+    ui->loadFileButton->setEnabled(!busy);
+    ui->cancelButton->setEnabled(false);
+}
@@ -0,0 +1,71 @@
+/**
+ * @file PlotDialog.cpp
+ * @brief 函数绘图对话框实现
+ */
+
+#include "PlotDialog.h"
+#include "ui_PlotDialog.h"
+#include "Expression.h"
+#include <QEvent>
+#include <QShowEvent>
+
+PlotDialog::PlotDialog(QWidget *parent)
+    : QDialog(parent)
+    , ui(new Ui::PlotDialog())
+    , m_retranslatePending(false)
+{
+    ui->setupUi(this);
+
+    connect(ui->plotButton, &QPushButton::clicked, this, &PlotDialog::onPlotClicked);
+    connect(ui->resetViewButton, &QPushButton::clicked, ui->plotWidget, &FunctionPlotWidget::resetView);
+    connect(ui->plotWidget, &FunctionPlotWidget::statsChanged, ui->statusLabel, &QLabel::setText);
+
+    ui->formulaEdit->setText("sin(x)");
+    onPlotClicked();
+}
+
+PlotDialog::~PlotDialog()
+{
+    delete ui;
+}
+
+void PlotDialog::changeEvent(QEvent *event)
+{
+    if (event->type() == QEvent::LanguageChange) {
+        // 对话框隐藏时只做标记
+        if (isVisible())
+            retranslate();
+        else
+            m_retranslatePending = true;
+    }
+    QDialog::changeEvent(event);
+}
+
+void PlotDialog::showEvent(QShowEvent *event)
+{
+    if (m_retranslatePending) {
+        m_retranslatePending = false;
+        retranslate();
+    }
+    QDialog::showEvent(event);
+}
+
+void PlotDialog::retranslate()
+{
+    // 状态栏显示的是运行结果，翻译后保留
+    const QString status = ui->statusLabel->text();
+    ui->retranslateUi(this);
+    ui->statusLabel->setText(status);
+}
+
+void PlotDialog::onPlotClicked()
+{
+    Expression expression;
+    QString error;
+    if (!expression.compile(ui->formulaEdit->text(), &error)) {
+        ui->statusLabel->setText(tr("表达式错误: %1").arg(error));
+        return;
+    }
+
+    ui->plotWidget->setExpression(expression);
+}
@@ -0,0 +1,198 @@
+/**
+ * @file PlotSampler.cpp
+ * @brief 函数采样器实现
+ */
+
+#include "PlotSampler.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+namespace {
+
+const double kTilesPerView = 4.0;   // 视图内约4~8个分块
+const int kBaseSamples = 128;       // 每个分块的均匀采样段数
+const int kMaxDepth = 7;            // 每段最多细分的层数
+const double kCurveTolerance = 1e-3;  // 中点偏离弦的容差（相对分块值域）
+const double kJumpRatio = 0.02;     // 最细一层仍超过该比例的跳变才检查是否间断
+const double kJumpSkew = 0.05;      // 中点落在跳变两端5%以内视为间断
+const size_t kMaxTiles = 256;
+const qint64 kMaxTilesPerView = 64;
+
+inline bool isFinite(double v) { return std::isfinite(v); }
+
+} // namespace
+
+PlotSampler::PlotSampler(const Expression &expression)
+    : m_expression(expression)
+    , m_useCounter(0)
+    , m_evaluations(0)
+{
+}
+
+std::vector<QPointF> PlotSampler::sample(double xMin, double xMax)
+{
+    std::vector<QPointF> result;
+    if (!m_expression.isValid() || !(xMax > xMin))
+        return result;
+
+    const int level = int(std::ceil(std::log2((xMax - xMin) / kTilesPerView)));
+    const double width = std::ldexp(1.0, level);
+    const double first = std::floor(xMin / width);
+    const double last = std::floor(xMax / width);
+    if (last - first >= kMaxTilesPerView
+        || std::fabs(first) > double(std::numeric_limits<qint64>::max() / 2))
+        return result;
+
+    // 收集视图需要的分块，命中缓存的直接复用
+    const qint64 firstIndex = qint64(first);
+    const qint64 tileCount = qint64(last - first) + 1;
+    std::vector<std::shared_ptr<const Tile>> tiles(static_cast<size_t>(tileCount));
+    std::vector<qint64> missing;
+    for (qint64 i = 0; i < tileCount; ++i) {
+        auto it = m_tiles.find(TileKey(level, firstIndex + i));
+        if (it != m_tiles.end()) {
+            it->second.lastUsed = ++m_useCounter;
+            tiles[size_t(i)] = it->second.points;
+        } else {
+            missing.push_back(i);
+        }
+    }
+
+    // 缺失的分块分配给多个线程并行采样
+    if (!missing.empty()) {
+        const size_t threadCount = std::min<size_t>(
+            missing.size(), std::max(1u, std::thread::hardware_concurrency()));
+        std::atomic<size_t> next(0);
+        auto worker = [&]() {
+            for (size_t k = next++; k < missing.size(); k = next++) {
+                const qint64 i = missing[k];
+                tiles[size_t(i)] = computeTile(level, firstIndex + i);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (size_t t = 1; t < threadCount; ++t)
+            threads.emplace_back(worker);
+        worker();
+        for (std::thread &thread : threads)
+            thread.join();
+
+        for (qint64 i : missing)
+            m_tiles[TileKey(level, firstIndex + i)] = { tiles[size_t(i)], ++m_useCounter };
+        evictTiles();
+    }
+
+    // 拼接分块，只保留视图内的点及两侧各一个点（保证曲线延伸到边缘）
+    for (const std::shared_ptr<const Tile> &tile : tiles) {
+        for (const QPointF &point : *tile) {
+            if (!result.empty() && point.x() <= result.back().x())
+                continue;  // 相邻分块共享端点
+            if (point.x() < xMin) {
+                if (!result.empty())
+                    result.back() = point;
+                else
+                    result.push_back(point);
+                continue;
+            }
+            result.push_back(point);
+            if (point.x() > xMax)
+                return result;
+        }
+    }
+    return result;
+}
+
+std::shared_ptr<const PlotSampler::Tile> PlotSampler::computeTile(int level, qint64 index) const
+{
+    const double width = std::ldexp(1.0, level);
+    const double x0 = double(index) * width;
+    const double step = width / kBaseSamples;
+    quint64 evaluations = 0;
+
+    std::vector<double> ys(kBaseSamples + 1);
+    double yMin = std::numeric_limits<double>::max();
+    double yMax = std::numeric_limits<double>::lowest();
+    for (int i = 0; i <= kBaseSamples; ++i) {
+        ys[size_t(i)] = m_expression.evaluate(x0 + i * step);
+        if (isFinite(ys[size_t(i)])) {
+            yMin = std::min(yMin, ys[size_t(i)]);
+            yMax = std::max(yMax, ys[size_t(i)]);
+        }
+    }
+    evaluations += kBaseSamples + 1;
+
+    // 容差取分块值域的比例，与坐标缩放无关
+    const double range = yMax > yMin ? yMax - yMin : 1.0;
+    const double tolerance = range * kCurveTolerance;
+    const double jump = range * kJumpRatio;
+
+    auto tile = std::make_shared<Tile>();
+    tile->reserve(size_t(kBaseSamples) * 2);
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (int i = 0; i < kBaseSamples; ++i) {
+        const double xa = x0 + i * step;
+        const double xb = x0 + (i + 1) * step;
+        tile->emplace_back(xa, isFinite(ys[size_t(i)]) ? ys[size_t(i)] : nan);
+        refine(xa, ys[size_t(i)], xb, ys[size_t(i + 1)], 0, tolerance, jump, tile.get(), &evaluations);
+    }
+    tile->emplace_back(x0 + width, isFinite(ys[kBaseSamples]) ? ys[kBaseSamples] : nan);
+
+    m_evaluations += evaluations;
+    return tile;
+}
+
+// 递归细分(x0, x1)区间，只输出区间内部的点
+void PlotSampler::refine(double x0, double y0, double x1, double y1, int depth,
+                         double tolerance, double jump, Tile *out, quint64 *evaluations) const
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    if (depth >= kMaxDepth) {
+        // 已细分到极限仍有大幅跳变：中点若明显偏向一端或落在两端之外，
+        // 说明跳变集中在一点（间断），断开曲线；否则只是陡峭的连续段
+        if (isFinite(y0) && isFinite(y1) && std::fabs(y1 - y0) > jump) {
+            const double ym = m_expression.evaluate((x0 + x1) / 2);
+            ++*evaluations;
+            const double t = (ym - y0) / (y1 - y0);
+            if (!(t > kJumpSkew && t < 1.0 - kJumpSkew))
+                out->emplace_back((x0 + x1) / 2, nan);
+        }
+        return;
+    }
+
+    const double xm = (x0 + x1) / 2;
+    const double ym = m_expression.evaluate(xm);
+    ++*evaluations;
+
+    const int finiteCount = int(isFinite(y0)) + int(isFinite(ym)) + int(isFinite(y1));
+    bool split;
+    if (finiteCount == 0)
+        split = false;
+    else if (finiteCount < 3)
+        split = true;   // 定义域边界，细分以逼近
+    else
+        split = std::fabs(ym - (y0 + y1) / 2) > tolerance;
+
+    if (split)
+        refine(x0, y0, xm, ym, depth + 1, tolerance, jump, out, evaluations);
+    out->emplace_back(xm, isFinite(ym) ? ym : nan);
+    if (split)
+        refine(xm, ym, x1, y1, depth + 1, tolerance, jump, out, evaluations);
+}
+
+void PlotSampler::evictTiles()
+{
+    if (m_tiles.size() <= kMaxTiles)
+        return;
+
+    std::vector<std::pair<quint64, TileKey>> order;
+    order.reserve(m_tiles.size());
+    for (const auto &entry : m_tiles)
+        order.emplace_back(entry.second.lastUsed, entry.first);
+    std::sort(order.begin(), order.end());
+
+    const size_t excess = m_tiles.size() - kMaxTiles;
+    for (size_t i = 0; i < excess; ++i)
+        m_tiles.erase(order[i].second);
+}
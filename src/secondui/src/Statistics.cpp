@@ -0,0 +1,271 @@
+/**
+ * @file Statistics.cpp
+ * @brief 单遍流式统计实现
+ */
+
+#include "Statistics.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace {
+
+const int kMaxMantissaDigits = 19;   // uint64能精确容纳的十进制位数
+const int kMaxExponent = 400;
+
+// 10^0..10^22均可用double精确表示
+const double kExactPowers[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+inline bool isSeparator(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == ',' || c == ';';
+}
+
+inline bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+} // namespace
+
+// ============================================
+// RunningStats
+// ============================================
+
+RunningStats::RunningStats()
+    : m_count(0)
+    , m_mean(0.0)
+    , m_m2(0.0)
+    , m_min(std::numeric_limits<double>::infinity())
+    , m_max(-std::numeric_limits<double>::infinity())
+{
+}
+
+void RunningStats::add(double value)
+{
+    ++m_count;
+    const double delta = value - m_mean;
+    m_mean += delta / double(m_count);
+    m_m2 += delta * (value - m_mean);
+    m_min = std::min(m_min, value);
+    m_max = std::max(m_max, value);
+}
+
+double RunningStats::variance() const
+{
+    return m_count > 1 ? m_m2 / double(m_count - 1) : 0.0;
+}
+
+double RunningStats::standardDeviation() const
+{
+    return std::sqrt(variance());
+}
+
+// ============================================
+// P2Quantile
+// ============================================
+
+P2Quantile::P2Quantile(double p)
+    : m_p(p)
+    , m_count(0)
+{
+    // 位置按算法原文从1开始计
+    for (int i = 0; i < 5; ++i) {
+        m_heights[i] = 0.0;
+        m_positions[i] = i + 1;
+    }
+    m_desired[0] = 1;
+    m_desired[1] = 1 + 2 * p;
+    m_desired[2] = 1 + 4 * p;
+    m_desired[3] = 3 + 2 * p;
+    m_desired[4] = 5;
+    m_increments[0] = 0;
+    m_increments[1] = p / 2;
+    m_increments[2] = p;
+    m_increments[3] = (1 + p) / 2;
+    m_increments[4] = 1;
+}
+
+void P2Quantile::add(double value)
+{
+    if (m_count < 5) {
+        m_heights[m_count++] = value;
+        if (m_count == 5)
+            std::sort(m_heights, m_heights + 5);
+        return;
+    }
+    ++m_count;
+
+    // 找到新值所在的区间，更新极值标记
+    int k;
+    if (value < m_heights[0]) {
+        m_heights[0] = value;
+        k = 0;
+    } else if (value >= m_heights[4]) {
+        m_heights[4] = value;
+        k = 3;
+    } else {
+        k = 0;
+        while (k < 3 && value >= m_heights[k + 1])
+            ++k;
+    }
+
+    for (int i = k + 1; i < 5; ++i)
+        m_positions[i] += 1;
+    for (int i = 0; i < 5; ++i)
+        m_desired[i] += m_increments[i];
+
+    // 中间三个标记偏离期望位置超过1时移动一格，优先用抛物线插值
+    for (int i = 1; i <= 3; ++i) {
+        const double d = m_desired[i] - m_positions[i];
+        if ((d >= 1 && m_positions[i + 1] - m_positions[i] > 1)
+            || (d <= -1 && m_positions[i - 1] - m_positions[i] < -1)) {
+            const int step = d > 0 ? 1 : -1;
+            const double candidate = parabolic(i, step);
+            if (m_heights[i - 1] < candidate && candidate < m_heights[i + 1])
+                m_heights[i] = candidate;
+            else
+                m_heights[i] = linear(i, step);
+            m_positions[i] += step;
+        }
+    }
+}
+
+double P2Quantile::value() const
+{
+    if (m_count >= 5)
+        return m_heights[2];
+    if (m_count == 0)
+        return std::numeric_limits<double>::quiet_NaN();
+
+    // 样本不足5个时直接取精确分位
+    std::vector<double> sorted(m_heights, m_heights + m_count);
+    std::sort(sorted.begin(), sorted.end());
+    return sorted[size_t(std::lround(m_p * double(m_count - 1)))];
+}
+
+double P2Quantile::parabolic(int i, double d) const
+{
+    const double *q = m_heights;
+    const double *n = m_positions;
+    return q[i] + d / (n[i + 1] - n[i - 1])
+                      * ((n[i] - n[i - 1] + d) * (q[i + 1] - q[i]) / (n[i + 1] - n[i])
+                         + (n[i + 1] - n[i] - d) * (q[i] - q[i - 1]) / (n[i] - n[i - 1]));
+}
+
+double P2Quantile::linear(int i, int d) const
+{
+    return m_heights[i] + d * (m_heights[i + d] - m_heights[i]) / (m_positions[i + d] - m_positions[i]);
+}
+
+// ============================================
+// DatasetStatistics
+// ============================================
+
+DatasetStatistics::DatasetStatistics()
+    : m_q1(0.25)
+    , m_median(0.5)
+    , m_q3(0.75)
+    , m_p95(0.95)
+{
+}
+
+void DatasetStatistics::add(double value)
+{
+    m_stats.add(value);
+    m_q1.add(value);
+    m_median.add(value);
+    m_q3.add(value);
+    m_p95.add(value);
+}
+
+int64_t DatasetStatistics::addText(const char *begin, const char *end)
+{
+    int64_t skipped = 0;
+    const char *p = begin;
+    while (p < end) {
+        while (p < end && isSeparator(*p))
+            ++p;
+        const char *tokenBegin = p;
+        while (p < end && !isSeparator(*p))
+            ++p;
+        if (tokenBegin == p)
+            break;
+
+        double value;
+        if (parseNumber(tokenBegin, p, &value))
+            add(value);
+        else
+            ++skipped;
+    }
+    return skipped;
+}
+
+/**
+ * 不依赖当前locale的十进制解析（strtod会受系统区域的小数点设置影响）
+ * 超过19位的有效数字被截断，误差远小于统计结果的显示精度
+ */
+bool DatasetStatistics::parseNumber(const char *begin, const char *end, double *value)
+{
+    const char *p = begin;
+    bool negative = false;
+    if (p < end && (*p == '+' || *p == '-'))
+        negative = *p++ == '-';
+
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    bool anyDigit = false;
+
+    for (; p < end && isDigit(*p); ++p) {
+        anyDigit = true;
+        if (digits < kMaxMantissaDigits) {
+            mantissa = mantissa * 10 + uint64_t(*p - '0');
+            if (mantissa)
+                ++digits;
+        } else {
+            ++exponent;
+        }
+    }
+    if (p < end && *p == '.') {
+        for (++p; p < end && isDigit(*p); ++p) {
+            anyDigit = true;
+            if (digits < kMaxMantissaDigits) {
+                mantissa = mantissa * 10 + uint64_t(*p - '0');
+                if (mantissa)
+                    ++digits;
+                --exponent;
+            }
+        }
+    }
+    if (!anyDigit)
+        return false;
+
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        ++p;
+        bool negativeExponent = false;
+        if (p < end && (*p == '+' || *p == '-'))
+            negativeExponent = *p++ == '-';
+        if (p == end || !isDigit(*p))
+            return false;
+        int e = 0;
+        for (; p < end && isDigit(*p); ++p)
+            e = std::min(e * 10 + (*p - '0'), kMaxExponent);
+        exponent += negativeExponent ? -e : e;
+    }
+    if (p != end)
+        return false;
+
+    double result = double(mantissa);
+    if (exponent > 0)
+        result *= exponent <= 22 ? kExactPowers[exponent] : std::pow(10.0, exponent);
+    else if (exponent < 0)
+        result /= -exponent <= 22 ? kExactPowers[-exponent] : std::pow(10.0, -exponent);
+
+    *value = negative ? -result : result;
+    return true;
+}
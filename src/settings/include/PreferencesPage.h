@@ -27,6 +27,13 @@ public:
 
     static QString pageName() { return QObject::tr("首选项"); }
 
+    // 在创建主窗口之前应用保存的语言，避免界面先以源语言构建
+    static void applySavedLanguage();
+
+protected:
+    void changeEvent(QEvent *event) override;
+    void showEvent(QShowEvent *event) override;
+
 private slots:
     // 外观设置
     void onThemeChanged(int index);
@@ -50,11 +57,13 @@ private:
     void setupConnections();
     void applyTheme(int themeIndex);
     void updateStatusLabel();
+    void retranslate();
 
 private:
     Ui::PreferencesPage *ui;
     QSettings *m_settings;
     bool m_settingsChanged;
+    bool m_retranslatePending;   // 隐藏时收到语言切换，下次显示时再翻译
 };
 
 #endif // PREFERENCESPAGE_H
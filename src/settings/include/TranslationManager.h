@@ -0,0 +1,35 @@
+/**
+ * @file TranslationManager.h
+ * @brief 运行时语言切换 - 内存映射翻译文件并在进程内共享
+ */
+
+#ifndef TRANSLATIONMANAGER_H
+#define TRANSLATIONMANAGER_H
+
+#include <QString>
+
+/**
+ * 翻译管理
+ * 翻译文件（.qm）通过内存映射加载，QTranslator直接引用映射区域，
+ * 不复制数据；同一语言只加载一次，再次切换时复用已有的翻译器。
+ * 安装/移除翻译器时Qt会向所有窗口发送LanguageChange事件，
+ * 各页面据此重新翻译界面。
+ */
+class TranslationManager
+{
+public:
+    // 与首选项中语言下拉框的顺序一致
+    enum Language {
+        Chinese = 0,   // 源语言，无需翻译文件
+        English = 1
+    };
+
+    // 切换语言，找不到或无法加载翻译文件时返回false
+    static bool setLanguage(int language, QString *error = nullptr);
+    static int currentLanguage();
+
+private:
+    TranslationManager() = delete;
+};
+
+#endif // TRANSLATIONMANAGER_H
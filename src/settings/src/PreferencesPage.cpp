@@ -5,7 +5,12 @@
 
 #include "PreferencesPage.h"
 #include "ui_PreferencesPage.h"
+#include "TranslationManager.h"
 #include <QDebug>
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QShowEvent>
+#include <QSignalBlocker>
 #include <QMessageBox>
 #include <QApplication>
 #include <QStyleFactory>
@@ -15,6 +20,7 @@ PreferencesPage::PreferencesPage(QWidget *parent)
     , ui(new Ui::PreferencesPage())
     , m_settings(new QSettings("LiquidCam", "Preferences", this))
     , m_settingsChanged(false)
+    , m_retranslatePending(false)
 {
     ui->setupUi(this);
     
@@ -29,6 +35,45 @@ PreferencesPage::~PreferencesPage()
     delete ui;
 }
 
+void PreferencesPage::applySavedLanguage()
+{
+    QSettings settings("LiquidCam", "Preferences");
+    QString error;
+    if (!TranslationManager::setLanguage(settings.value("appearance/language", 0).toInt(), &error))
+        qWarning() << error;
+}
+
+void PreferencesPage::changeEvent(QEvent *event)
+{
+    if (event->type() == QEvent::LanguageChange) {
+        // 隐藏时推迟到 showEvent
+        if (isVisible())
+            retranslate();
+        else
+            m_retranslatePending = true;
+    }
+    QWidget::changeEvent(event);
+}
+
+void PreferencesPage::showEvent(QShowEvent *event)
+{
+    if (m_retranslatePending) {
+        m_retranslatePending = false;
+        retranslate();
+    }
+    QWidget::showEvent(event);
+}
+
+void PreferencesPage::retranslate()
+{
+    // retranslateUi 只改文字，下拉框的当前项保持不变；状态提示由代码设置，需重新生成
+    QElapsedTimer timer;
+    timer.start();
+    ui->retranslateUi(this);
+    updateStatusLabel();
+    qDebug() << "偏好设置页重新翻译耗时:" << timer.nsecsElapsed() / 1000 << "us";
+}
+
 void PreferencesPage::setupConnections()
 {
     // 外观设置
@@ -134,7 +179,15 @@ void PreferencesPage::applyTheme(int themeIndex)
 
 void PreferencesPage::onLanguageChanged(int index)
 {
-    Q_UNUSED(index)
+    // 立即切换，无需重启；失败时下拉框退回当前使用的语言
+    QString error;
+    if (!TranslationManager::setLanguage(index, &error)) {
+        const QSignalBlocker blocker(ui->languageCombo);
+        ui->languageCombo->setCurrentIndex(TranslationManager::currentLanguage());
+        updateStatusLabel();
+        ui->statusLabel->setText(error);
+        return;
+    }
     m_settingsChanged = true;
     updateStatusLabel();
 }
@@ -0,0 +1,103 @@
+/**
+ * @file TranslationManager.cpp
+ * @brief 运行时语言切换实现
+ */
+
+#include "TranslationManager.h"
+#include <QCoreApplication>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QPointer>
+#include <QTranslator>
+
+namespace {
+
+// 翻译文件名: <程序目录>/translations/multipagedemo_<后缀>.qm
+const char *const kCatalogSuffixes[] = { nullptr, "en" };
+
+struct Catalog
+{
+    QPointer<QFile> file;             // 保持打开以维持映射
+    QPointer<QTranslator> translator;
+};
+
+QHash<int, Catalog> &catalogs()
+{
+    static QHash<int, Catalog> cache;
+    return cache;
+}
+
+int &installedLanguage()
+{
+    static int language = TranslationManager::Chinese;
+    return language;
+}
+
+QTranslator *loadCatalog(int language, QString *error)
+{
+    Catalog &catalog = catalogs()[language];
+    if (catalog.translator)
+        return catalog.translator;
+
+    const QString fileName = QStringLiteral("multipagedemo_%1.qm")
+                                 .arg(QLatin1String(kCatalogSuffixes[language]));
+    const QString path = QDir(QCoreApplication::applicationDirPath())
+                             .filePath(QStringLiteral("translations/") + fileName);
+
+    // 文件和翻译器都挂在应用对象下，随应用一起释放
+    QFile *file = new QFile(path, qApp);
+    uchar *data = nullptr;
+    if (file->open(QIODevice::ReadOnly))
+        data = file->map(0, file->size());
+
+    QTranslator *translator = new QTranslator(qApp);
+    if (!data || !translator->load(data, int(file->size()), QFileInfo(path).absolutePath())) {
+        if (error)
+            *error = QObject::tr("无法加载翻译文件: %1").arg(QDir::toNativeSeparators(path));
+        delete translator;
+        delete file;
+        catalogs().remove(language);
+        return nullptr;
+    }
+
+    catalog.file = file;
+    catalog.translator = translator;
+    return translator;
+}
+
+} // namespace
+
+bool TranslationManager::setLanguage(int language, QString *error)
+{
+    if (language < Chinese || language > English) {
+        if (error)
+            *error = QObject::tr("不支持的语言");
+        return false;
+    }
+    if (language == installedLanguage())
+        return true;
+
+    // 先加载新翻译再移除旧翻译，加载失败时界面保持原样
+    QTranslator *translator = nullptr;
+    if (language != Chinese) {
+        translator = loadCatalog(language, error);
+        if (!translator)
+            return false;
+    }
+
+    const Catalog previous = catalogs().value(installedLanguage());
+    if (previous.translator)
+        QCoreApplication::removeTranslator(previous.translator);
+    if (translator)
+        QCoreApplication::installTranslator(translator);
+
+    installedLanguage() = language;
+    return true;
+}
+
+int TranslationManager::currentLanguage()
+{
+    return installedLanguage();
+}
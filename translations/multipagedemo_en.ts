@@ -0,0 +1,1729 @@
+<?xml version="1.0" encoding="utf-8"?>
+<!DOCTYPE TS>
+<TS version="2.1" language="en_US" sourcelanguage="zh_CN">
+<context>
+    <name>BatchRenameDialog</name>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenameDialog.cpp" line="72"/>
+        <source>已选择 %1 项，正在检查重名...</source>
+        <translation>%1 items selected, checking for duplicate names...</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenameDialog.cpp" line="97"/>
+        <source>正在检查重名...</source>
+        <translation>Checking for duplicate names...</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenameDialog.cpp" line="109"/>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="256"/>
+        <source>在文件列表中选择文件后设置规则</source>
+        <translation>Select files in the file list, then set up the rules</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenameDialog.cpp" line="111"/>
+        <source>共 %1 项，其中 %2 项重名或名称无效（红色标出）</source>
+        <translation>%1 items, %2 with duplicate or invalid names (shown in red)</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenameDialog.cpp" line="113"/>
+        <source>共 %1 项，将重命名 %2 项</source>
+        <translation>%1 items, %2 will be renamed</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenameDialog.cpp" line="114"/>
+        <source>；</source>
+        <translation>; </translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenameDialog.cpp" line="122"/>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="14"/>
+        <source>批量重命名</source>
+        <translation>Batch Rename</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenameDialog.cpp" line="123"/>
+        <source>将处理 %1 下的 %2 项。
+执行前会检查与目录中已有文件的冲突，失败时自动回滚。是否继续？</source>
+        <translation>This will process %2 items in %1.
+Conflicts with existing files are checked first, and everything is rolled back on failure. Continue?</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenameDialog.cpp" line="134"/>
+        <source>正在处理...</source>
+        <translation>Processing...</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenameDialog.cpp" line="143"/>
+        <source>撤销</source>
+        <translation>Undo</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenameDialog.cpp" line="144"/>
+        <source>将恢复上次处理的 %1 项的名称和属性。是否继续？</source>
+        <translation>This will restore the names and attributes of the %1 items processed last time. Continue?</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenameDialog.cpp" line="152"/>
+        <source>正在撤销...</source>
+        <translation>Undoing...</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenameDialog.cpp" line="165"/>
+        <source>正在按恢复日志恢复 %1 ...</source>
+        <translation>Restoring %1 from the recovery log...</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenameDialog.cpp" line="173"/>
+        <source>正在取消并回滚...</source>
+        <translation>Cancelling and rolling back...</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenameDialog.cpp" line="179"/>
+        <source>正在处理... %1 / %2</source>
+        <translation>Processing... %1 / %2</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="39"/>
+        <source>名称模板:</source>
+        <translation>Name template:</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="49"/>
+        <source>{name} 原名称（已做查找替换），{ext} 扩展名（含点），{n} 序号</source>
+        <translation>{name} original name (after find/replace), {ext} extension (with dot), {n} counter</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="56"/>
+        <source>查找:</source>
+        <translation>Find:</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="63"/>
+        <source>在原名称（不含扩展名）中查找</source>
+        <translation>Find in the original name (without extension)</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="70"/>
+        <source>替换为:</source>
+        <translation>Replace with:</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="77"/>
+        <source>使用正则时可用 \1、\2 引用捕获组</source>
+        <translation>With regex, use \1, \2 to refer to capture groups</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="84"/>
+        <source>序号:</source>
+        <translation>Counter:</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="93"/>
+        <source>起始</source>
+        <translation>Start</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="110"/>
+        <source>步长</source>
+        <translation>Step</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="127"/>
+        <source>位数</source>
+        <translation>Digits</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="147"/>
+        <source>正则</source>
+        <translation>Regex</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="163"/>
+        <source>属性:</source>
+        <translation>Attributes:</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="171"/>
+        <source>不修改</source>
+        <translation>Keep</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="176"/>
+        <source>设为只读</source>
+        <translation>Make read-only</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="181"/>
+        <source>取消只读</source>
+        <translation>Make writable</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="186"/>
+        <source>修改时间设为当前时间</source>
+        <translation>Set modified time to now</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="212"/>
+        <source>✔ 执行</source>
+        <translation>✔ Apply</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="222"/>
+        <source>↶ 撤销上次</source>
+        <translation>↶ Undo Last</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="232"/>
+        <source>取消</source>
+        <translation>Cancel</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/BatchRenameDialog.ui" line="235"/>
+        <source>取消后已完成的部分会回滚</source>
+        <translation>Cancelling rolls back what has been done</translation>
+    </message>
+</context>
+<context>
+    <name>BatchRenamer</name>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="616"/>
+        <source>无效的名称: %1 → %2</source>
+        <translation>Invalid name: %1 → %2</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="629"/>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="757"/>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="826"/>
+        <source>无法打开目录: %1</source>
+        <translation>Cannot open folder: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="656"/>
+        <source>无法读取属性 %1: %2</source>
+        <translation>Cannot read attributes of %1: %2</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="680"/>
+        <source>无法修改属性 %1: %2</source>
+        <translation>Cannot change attributes of %1: %2</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="703"/>
+        <source>已取消，已回滚 %1 步操作</source>
+        <translation>Cancelled; rolled back %1 operations</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="704"/>
+        <source>%1，已回滚</source>
+        <translation>%1; rolled back</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="706"/>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="776"/>
+        <source>（%1 步回滚失败，详见日志）</source>
+        <translation> (%1 rollback steps failed, see the log)</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="726"/>
+        <source>完成: 重命名 %1 项，修改属性 %2 项，用时 %3 秒</source>
+        <translation>Done: renamed %1 items, changed attributes of %2 items in %3 s</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="731"/>
+        <source>（跳过 %1 个符号链接的属性修改）</source>
+        <translation> (skipped attribute changes on %1 symbolic links)</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="774"/>
+        <source>撤销已取消</source>
+        <translation>Undo cancelled</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="774"/>
+        <source>撤销失败: %1</source>
+        <translation>Undo failed: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="811"/>
+        <source>已撤销 %1 项</source>
+        <translation>Undid %1 items</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="813"/>
+        <source>已取消：名称已恢复，%1 项属性未恢复</source>
+        <translation>Cancelled: names restored, attributes of %1 items not restored</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="815"/>
+        <source>，%1 项属性未能恢复</source>
+        <translation>, attributes of %1 items could not be restored</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="854"/>
+        <source>恢复已取消，已恢复 %1 步，下次启动时可继续</source>
+        <translation>Recovery cancelled after restoring %1 steps; it can continue at the next start</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="856"/>
+        <source>已恢复 %1 步，%2 步失败（详见日志），下次启动时可重试</source>
+        <translation>Restored %1 steps, %2 failed (see the log); it can be retried at the next start</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="858"/>
+        <source>已按恢复日志恢复 %1 步改名</source>
+        <translation>Restored %1 rename steps from the recovery log</translation>
+    </message>
+</context>
+<context>
+    <name>CalculatorPage</name>
+    <message>
+        <location filename="../src/secondui/src/CalculatorPage.cpp" line="249"/>
+        <source>错误：除数不能为零</source>
+        <translation>Error: division by zero</translation>
+    </message>
+</context>
+<context>
+    <name>CompareResultModel</name>
+    <message>
+        <location filename="../src/dashboard/src/CompareResultModel.cpp" line="54"/>
+        <source>＋ 仅左侧    %1</source>
+        <translation>+ Left only    %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/CompareResultModel.cpp" line="56"/>
+        <source>－ 仅右侧    %1</source>
+        <translation>- Right only    %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/CompareResultModel.cpp" line="58"/>
+        <source>⚠ 类型不同    %1</source>
+        <translation>⚠ Type differs    %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/CompareResultModel.cpp" line="60"/>
+        <source>＝ 仅时间不同    %1</source>
+        <translation>= Timestamp only    %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/CompareResultModel.cpp" line="63"/>
+        <source>≠ 已修改    %1    (%2 / %3 块不同)</source>
+        <translation>≠ Modified    %1    (%2 / %3 blocks differ)</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/CompareResultModel.cpp" line="66"/>
+        <source>≠ 已修改    %1    (%2 → %3)</source>
+        <translation>≠ Modified    %1    (%2 → %3)</translation>
+    </message>
+</context>
+<context>
+    <name>DirectoryCompareDialog</name>
+    <message>
+        <location filename="../src/dashboard/src/DirectoryCompareDialog.cpp" line="67"/>
+        <source>选择左侧目录</source>
+        <translation>Choose the left folder</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/DirectoryCompareDialog.cpp" line="74"/>
+        <source>选择右侧目录</source>
+        <translation>Choose the right folder</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/DirectoryCompareDialog.cpp" line="84"/>
+        <source>请选择两个存在的目录</source>
+        <translation>Choose two existing folders</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/DirectoryCompareDialog.cpp" line="91"/>
+        <source>两侧是同一个目录</source>
+        <translation>Both sides are the same folder</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/DirectoryCompareDialog.cpp" line="95"/>
+        <source>一侧目录位于另一侧之内，无法比较</source>
+        <translation>One folder is inside the other and cannot be compared</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/DirectoryCompareDialog.cpp" line="105"/>
+        <source>正在比较...</source>
+        <translation>Comparing...</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/DirectoryCompareDialog.cpp" line="117"/>
+        <source>没有需要同步的项</source>
+        <translation>Nothing to sync</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/DirectoryCompareDialog.cpp" line="122"/>
+        <source>同步目录</source>
+        <translation>Sync Folders</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/DirectoryCompareDialog.cpp" line="123"/>
+        <source>将把 %1 项变化从
+%2
+同步到
+%3
+
+仅右侧存在的项和类型不同的项不会改动。是否继续？</source>
+        <translation>This will sync %1 changes from
+%2
+to
+%3
+
+Items that only exist on the right or differ in type are left untouched. Continue?</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/DirectoryCompareDialog.cpp" line="132"/>
+        <source>正在同步...</source>
+        <translation>Syncing...</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/DirectoryCompareDialog.cpp" line="140"/>
+        <source>已取消</source>
+        <translation>Cancelled</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/DirectoryCompareDialog.cpp" line="158"/>
+        <source>差异 %1 项，相同 %2 个文件，用时 %3 秒</source>
+        <translation>%1 differences, %2 identical files, took %3 s</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/DirectoryCompareDialog.cpp" line="162"/>
+        <source>；</source>
+        <translation>; </translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/DirectoryCompareDialog.cpp" line="171"/>
+        <source>同步完成: 写入 %1 个文件，共 %2 MB，失败 %3 项</source>
+        <translation>Sync finished: wrote %1 files, %2 MB in total, %3 failed</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/DirectoryCompareDialog.ui" line="14"/>
+        <source>目录比较</source>
+        <translation>Compare Folders</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/DirectoryCompareDialog.ui" line="39"/>
+        <source>左侧（源）:</source>
+        <translation>Left (source):</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/DirectoryCompareDialog.ui" line="49"/>
+        <location filename="../src/dashboard/ui/DirectoryCompareDialog.ui" line="49"/>
+        <source>浏览...</source>
+        <translation>Browse...</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/DirectoryCompareDialog.ui" line="56"/>
+        <source>右侧（目标）:</source>
+        <translation>Right (target):</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/DirectoryCompareDialog.ui" line="79"/>
+        <source>🔍 比较</source>
+        <translation>🔍 Compare</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/DirectoryCompareDialog.ui" line="86"/>
+        <source>⇉ 同步到右侧</source>
+        <translation>⇉ Sync to Right</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/DirectoryCompareDialog.ui" line="89"/>
+        <source>以左侧为准复制新增和修改的文件；不删除仅右侧存在的项</source>
+        <translation>Copy new and modified files from the left; items that only exist on the right are not deleted</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/DirectoryCompareDialog.ui" line="99"/>
+        <source>取消</source>
+        <translation>Cancel</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/DirectoryCompareDialog.ui" line="132"/>
+        <source>选择两个目录后点击比较</source>
+        <translation>Choose two folders, then click Compare</translation>
+    </message>
+</context>
+<context>
+    <name>DirectoryComparer</name>
+    <message>
+        <location filename="../src/dashboard/src/DirectoryComparer.cpp" line="232"/>
+        <source>正在读取元数据: 左侧 %1 项，右侧 %2 项</source>
+        <translation>Reading metadata: %1 items on the left, %2 on the right</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/DirectoryComparer.cpp" line="342"/>
+        <source>正在逐块比较: %1 / %2 个文件</source>
+        <translation>Comparing blocks: %1 / %2 files</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/DirectoryComparer.cpp" line="421"/>
+        <source>正在同步: %1 / %2</source>
+        <translation>Syncing: %1 / %2</translation>
+    </message>
+</context>
+<context>
+    <name>FileManagerPage</name>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="75"/>
+        <source>Ctrl+P</source>
+        <translation>Ctrl+P</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="91"/>
+        <source>F2</source>
+        <translation>F2</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="165"/>
+        <source>大小: %1
+修改: %2</source>
+        <translation>Size: %1
+Modified: %2</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="175"/>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="725"/>
+        <source>文件夹: %1 | 文件: %2</source>
+        <translation>Folders: %1 | Files: %2</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="320"/>
+        <source>路径错误</source>
+        <translation>Path Error</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="320"/>
+        <source>路径不存在: %1</source>
+        <translation>Path does not exist: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="375"/>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="504"/>
+        <source>🔍 搜索文件内容，回车开始...</source>
+        <translation>🔍 Search file contents, press Enter to start...</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="380"/>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="505"/>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="137"/>
+        <source>🔍 搜索文件...</source>
+        <translation>🔍 Search files...</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="395"/>
+        <source>搜索条件无效</source>
+        <translation>Invalid search criteria</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="398"/>
+        <source>正在搜索: %1 ...</source>
+        <translation>Searching: %1 ...</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="423"/>
+        <source>正在搜索... 已扫描: %1 | 匹配: %2</source>
+        <translation>Searching... Scanned: %1 | Matches: %2</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="432"/>
+        <source>匹配过多，仅显示前 %1 条，请缩小搜索范围</source>
+        <translation>Too many matches, showing the first %1 only; narrow the search</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="435"/>
+        <source>搜索已取消 | 匹配: %1</source>
+        <translation>Search cancelled | Matches: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="436"/>
+        <source>搜索完成 | 匹配: %1</source>
+        <translation>Search finished | Matches: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="485"/>
+        <source>全部文件 (*.*)</source>
+        <translation>All files (*.*)</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="486"/>
+        <source>文本文件 (*.txt)</source>
+        <translation>Text files (*.txt)</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="487"/>
+        <source>图片文件 (*.png *.jpg *.bmp)</source>
+        <translation>Images (*.png *.jpg *.bmp)</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="488"/>
+        <source>文档 (*.pdf *.doc *.docx)</source>
+        <translation>Documents (*.pdf *.doc *.docx)</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="560"/>
+        <source>正在扫描... 目录: %1 | 节点: %2 | 内存: %3</source>
+        <translation>Scanning... Folders: %1 | Nodes: %2 | Memory: %3</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="572"/>
+        <source>%1 | 总计: %2 | 节点: %3</source>
+        <translation>%1 | Total: %2 | Nodes: %3</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="573"/>
+        <source>扫描已取消</source>
+        <translation>Scan cancelled</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="573"/>
+        <source>扫描完成</source>
+        <translation>Scan finished</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="593"/>
+        <source>文件列表加载中，请稍候</source>
+        <translation>The file list is loading, please wait</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="602"/>
+        <source>请先在列表中选择文件（Ctrl/Shift 多选）</source>
+        <translation>Select files in the list first (Ctrl/Shift for multiple)</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="642"/>
+        <source>批量重命名</source>
+        <translation>Batch Rename</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="643"/>
+        <source>上次在 %1 中的批量重命名没有正常结束（共 %2 步），部分文件可能仍是临时名称。
+
+是：恢复为执行前的名称
+否：暂不处理，下次再询问
+丢弃：删除这条记录，不再恢复</source>
+        <translation>The last batch rename in %1 did not finish (%2 steps); some files may still have temporary names.
+
+Yes: restore the names they had before
+No: leave it for now and ask again next time
+Discard: delete this record without restoring</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="743"/>
+        <source>大小: %1</source>
+        <translation>Size: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="744"/>
+        <source>类型: %1</source>
+        <translation>Type: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="745"/>
+        <source>修改: %1</source>
+        <translation>Modified: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="754"/>
+        <source>正在读取元数据...</source>
+        <translation>Reading metadata...</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="762"/>
+        <source>尺寸: %1 × %2</source>
+        <translation>Dimensions: %1 × %2</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="764"/>
+        <source>相机: %1</source>
+        <translation>Camera: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="766"/>
+        <source>拍摄: %1</source>
+        <translation>Taken: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="769"/>
+        <source>时长: %1:%2</source>
+        <translation>Duration: %1:%2</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="772"/>
+        <source>编码: %1</source>
+        <translation>Encoding: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="774"/>
+        <source>行数: %1</source>
+        <translation>Lines: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/FileManagerPage.cpp" line="776"/>
+        <source>SHA-256: %1</source>
+        <translation>SHA-256: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="14"/>
+        <source>文件管理器</source>
+        <translation>File Manager</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="37"/>
+        <source>📁 文件管理器</source>
+        <translation>📁 File Manager</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="51"/>
+        <source>⬆ 上级</source>
+        <translation>⬆ Up</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="54"/>
+        <source>返回上级目录</source>
+        <translation>Go to the parent folder</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="61"/>
+        <source>🏠 主页</source>
+        <translation>🏠 Home</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="64"/>
+        <source>跳转到用户目录</source>
+        <translation>Go to the home folder</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="71"/>
+        <source>🔄 刷新</source>
+        <translation>🔄 Refresh</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="74"/>
+        <source>刷新当前目录</source>
+        <translation>Refresh the current folder</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="81"/>
+        <source>⚡ 快速打开</source>
+        <translation>⚡ Quick Open</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="84"/>
+        <source>模糊匹配当前目录下的所有文件 (Ctrl+P)</source>
+        <translation>Fuzzy-match every file under the current folder (Ctrl+P)</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="91"/>
+        <source>📊 占用分析</source>
+        <translation>📊 Disk Usage</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="94"/>
+        <source>扫描当前磁盘并以矩形树图显示空间占用</source>
+        <translation>Scan the current disk and show space usage as a treemap</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="104"/>
+        <source>⇄ 目录比较</source>
+        <translation>⇄ Compare</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="107"/>
+        <source>将当前目录与另一个目录比较并同步</source>
+        <translation>Compare the current folder with another one and sync them</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="114"/>
+        <source>✎ 批量重命名</source>
+        <translation>✎ Batch Rename</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="117"/>
+        <source>按模板、序号或正则批量重命名选中的文件，或批量修改属性 (F2)</source>
+        <translation>Rename the selected files by template, counter or regex, or change their attributes (F2)</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="124"/>
+        <source>输入路径并回车跳转...</source>
+        <translation>Type a path and press Enter...</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="154"/>
+        <source>搜索内容</source>
+        <translation>Search contents</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="157"/>
+        <source>在当前目录下搜索文件内容，回车开始搜索</source>
+        <translation>Search file contents under the current folder; press Enter to start</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="164"/>
+        <source>正则</source>
+        <translation>Regex</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="174"/>
+        <source>排序方式（尺寸、行数、时长来自元数据缓存）</source>
+        <translation>Sort order (dimensions, lines and duration come from the metadata cache)</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="178"/>
+        <source>按名称</source>
+        <translation>By name</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="183"/>
+        <source>按大小</source>
+        <translation>By size</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="188"/>
+        <source>按修改时间</source>
+        <translation>By modified time</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="193"/>
+        <source>按图片尺寸</source>
+        <translation>By image dimensions</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="198"/>
+        <source>按行数</source>
+        <translation>By line count</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="203"/>
+        <source>按时长</source>
+        <translation>By duration</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="211"/>
+        <source>↑</source>
+        <translation>↑</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="214"/>
+        <source>切换升序/降序</source>
+        <translation>Toggle ascending/descending</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="245"/>
+        <source>目录</source>
+        <translation>Folders</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="269"/>
+        <source>文件</source>
+        <translation>Files</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="303"/>
+        <source>文件信息</source>
+        <translation>File Info</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="315"/>
+        <source>名称: --</source>
+        <translation>Name: --</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="325"/>
+        <source>大小: --</source>
+        <translation>Size: --</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="332"/>
+        <source>类型: --</source>
+        <translation>Type: --</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="339"/>
+        <source>修改: --</source>
+        <translation>Modified: --</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="359"/>
+        <source>计算校验和 (SHA-256)</source>
+        <translation>Compute checksum (SHA-256)</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/FileManagerPage.ui" line="380"/>
+        <source>就绪</source>
+        <translation>Ready</translation>
+    </message>
+</context>
+<context>
+    <name>FunctionPlotWidget</name>
+    <message>
+        <location filename="../src/secondui/src/FunctionPlotWidget.cpp" line="115"/>
+        <source>采样点: %1 | 绘制点: %2 | 新增求值: %3 | 缓存分块: %4 | 耗时: %5 ms</source>
+        <translation>Samples: %1 | Points drawn: %2 | New evaluations: %3 | Cached blocks: %4 | Time: %5 ms</translation>
+    </message>
+</context>
+<context>
+    <name>MainWindow</name>
+    <message>
+        <location filename="../src/mainui/ui/MainWindow.ui" line="14"/>
+        <source>多页面示例 - Widget提升版</source>
+        <translation>Multi-Page Demo - Promoted Widgets</translation>
+    </message>
+    <message>
+        <location filename="../src/mainui/ui/MainWindow.ui" line="50"/>
+        <source>导航菜单</source>
+        <translation>Navigation</translation>
+    </message>
+</context>
+<context>
+    <name>MatrixStatsDialog</name>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="170"/>
+        <source>矩阵 A: %1</source>
+        <translation>Matrix A: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="184"/>
+        <source>矩阵 B: %1</source>
+        <translation>Matrix B: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="196"/>
+        <source>维度不匹配: A 为 %1×%2，B 为 %3×%4</source>
+        <translation>Dimension mismatch: A is %1×%2, B is %3×%4</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="205"/>
+        <source>A × B 用时 %1</source>
+        <translation>A × B took %1</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="216"/>
+        <source>只有方阵才能求逆</source>
+        <translation>Only square matrices can be inverted</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="225"/>
+        <source>求逆失败</source>
+        <translation>Inversion failed</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="226"/>
+        <source>矩阵奇异（或接近奇异），不可逆</source>
+        <translation>The matrix is singular (or nearly singular) and cannot be inverted</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="228"/>
+        <source>A⁻¹ 用时 %1</source>
+        <translation>A⁻¹ took %1</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="239"/>
+        <source>需要 n×n 的 A 和 n 行的 B</source>
+        <translation>Requires an n×n matrix A and a B with n rows</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="248"/>
+        <source>求解失败</source>
+        <translation>Solve failed</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="249"/>
+        <source>矩阵 A 奇异（或接近奇异），方程组无唯一解</source>
+        <translation>Matrix A is singular (or nearly singular); the system has no unique solution</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="251"/>
+        <source>解 A·X = B 用时 %1</source>
+        <translation>Solving A·X = B took %1</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="263"/>
+        <source>[随机矩阵 %1×%1]</source>
+        <translation>[random %1×%1 matrix]</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="264"/>
+        <source>[随机矩阵 %1×1]</source>
+        <translation>[random %1×1 matrix]</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="268"/>
+        <source>已生成随机矩阵，编辑文本框即可改回手动输入</source>
+        <translation>Random matrices generated; edit a text box to switch back to manual input</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="279"/>
+        <source>统计用时 %1</source>
+        <translation>Statistics took %1</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="286"/>
+        <source>选择数据文件</source>
+        <translation>Choose a data file</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="287"/>
+        <source>文本数据 (*.txt *.csv *.dat);;所有文件 (*)</source>
+        <translation>Text data (*.txt *.csv *.dat);;All files (*)</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="298"/>
+        <source>无法打开文件</source>
+        <translation>Cannot open the file</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="299"/>
+        <source>无法打开: %1</source>
+        <translation>Cannot open: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="332"/>
+        <source>%1（%2 MB）统计用时 %3</source>
+        <translation>%1 (%2 MB) statistics took %3</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="347"/>
+        <source>正在取消...</source>
+        <translation>Cancelling...</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="358"/>
+        <source>计算中...</source>
+        <translation>Calculating...</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="375"/>
+        <source>已取消</source>
+        <translation>Cancelled</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/MatrixStatsDialog.ui" line="14"/>
+        <source>矩阵 / 统计</source>
+        <translation>Matrix / Statistics</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/MatrixStatsDialog.ui" line="41"/>
+        <source>矩阵</source>
+        <translation>Matrix</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/MatrixStatsDialog.ui" line="49"/>
+        <source>矩阵 A：每行一行，数字以空格或逗号分隔</source>
+        <translation>Matrix A: one row per line, numbers separated by spaces or commas</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/MatrixStatsDialog.ui" line="56"/>
+        <source>矩阵 B：乘法右操作数，或方程右端项</source>
+        <translation>Matrix B: right operand of the product, or right-hand side of the system</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/MatrixStatsDialog.ui" line="67"/>
+        <source>A × B</source>
+        <translation>A × B</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/MatrixStatsDialog.ui" line="74"/>
+        <source>A⁻¹</source>
+        <translation>A⁻¹</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/MatrixStatsDialog.ui" line="81"/>
+        <source>解 A·X = B</source>
+        <translation>Solve A·X = B</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/MatrixStatsDialog.ui" line="95"/>
+        <source>n = </source>
+        <translation>n = </translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/MatrixStatsDialog.ui" line="111"/>
+        <source>生成随机的 n×n 矩阵 A 和 n×1 矩阵 B</source>
+        <translation>Generate a random n×n matrix A and n×1 matrix B</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/MatrixStatsDialog.ui" line="114"/>
+        <source>随机填充</source>
+        <translation>Fill Randomly</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/MatrixStatsDialog.ui" line="136"/>
+        <source>统计</source>
+        <translation>Statistics</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/MatrixStatsDialog.ui" line="142"/>
+        <source>粘贴数据：数字以空白、逗号或分号分隔</source>
+        <translation>Paste data: numbers separated by whitespace, commas or semicolons</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/MatrixStatsDialog.ui" line="151"/>
+        <source>计算</source>
+        <translation>Calculate</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/MatrixStatsDialog.ui" line="158"/>
+        <source>从文件计算...</source>
+        <translation>From File...</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/MatrixStatsDialog.ui" line="165"/>
+        <source>取消</source>
+        <translation>Cancel</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/MatrixStatsDialog.ui" line="168"/>
+        <source>停止读取文件，已有的结果保持不变</source>
+        <translation>Stop reading the file; existing results are kept</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/MatrixStatsDialog.ui" line="200"/>
+        <source>就绪</source>
+        <translation>Ready</translation>
+    </message>
+</context>
+<context>
+    <name>PlotDialog</name>
+    <message>
+        <location filename="../src/secondui/src/PlotDialog.cpp" line="34"/>
+        <source>表达式错误: %1</source>
+        <translation>Expression error: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/PlotDialog.ui" line="14"/>
+        <source>函数绘图</source>
+        <translation>Function Plot</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/PlotDialog.ui" line="39"/>
+        <source>y =</source>
+        <translation>y =</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/PlotDialog.ui" line="46"/>
+        <source>例如: sin(x)/x、x^2 - 3x + 1、tan(x)</source>
+        <translation>e.g. sin(x)/x, x^2 - 3x + 1, tan(x)</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/PlotDialog.ui" line="53"/>
+        <source>绘制</source>
+        <translation>Plot</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/PlotDialog.ui" line="63"/>
+        <source>重置视图</source>
+        <translation>Reset View</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/PlotDialog.ui" line="86"/>
+        <source>拖动平移，滚轮缩放</source>
+        <translation>Drag to pan, scroll to zoom</translation>
+    </message>
+</context>
+<context>
+    <name>PreferencesPage</name>
+    <message>
+        <location filename="../src/settings/src/PreferencesPage.cpp" line="140"/>
+        <source>⚠ 有未保存的更改</source>
+        <translation>⚠ Unsaved changes</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/src/PreferencesPage.cpp" line="143"/>
+        <source>✓ 设置已保存</source>
+        <translation>✓ Settings saved</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/src/PreferencesPage.cpp" line="237"/>
+        <source>成功</source>
+        <translation>Success</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/src/PreferencesPage.cpp" line="237"/>
+        <source>设置已应用并保存！</source>
+        <translation>Settings applied and saved!</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/src/PreferencesPage.cpp" line="243"/>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="231"/>
+        <source>重置</source>
+        <translation>Reset</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/src/PreferencesPage.cpp" line="243"/>
+        <source>已恢复到最后保存的设置。</source>
+        <translation>Restored the last saved settings.</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/src/PreferencesPage.cpp" line="248"/>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="214"/>
+        <source>恢复默认</source>
+        <translation>Restore Defaults</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/src/PreferencesPage.cpp" line="249"/>
+        <source>确定要恢复所有设置为默认值吗？</source>
+        <translation>Restore all settings to their default values?</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/src/PreferencesPage.cpp" line="255"/>
+        <source>完成</source>
+        <translation>Done</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/src/PreferencesPage.cpp" line="255"/>
+        <source>已恢复默认设置。</source>
+        <translation>Default settings restored.</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="14"/>
+        <source>首选项</source>
+        <translation>Preferences</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="37"/>
+        <source>⚙️ 首选项</source>
+        <translation>⚙️ Preferences</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="49"/>
+        <source>外观</source>
+        <translation>Appearance</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="58"/>
+        <source>主题:</source>
+        <translation>Theme:</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="66"/>
+        <source>浅色</source>
+        <translation>Light</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="71"/>
+        <source>深色</source>
+        <translation>Dark</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="76"/>
+        <source>跟随系统</source>
+        <translation>Follow System</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="84"/>
+        <source>语言:</source>
+        <translation>Language:</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="92"/>
+        <source>简体中文</source>
+        <translation>简体中文</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="97"/>
+        <source>English</source>
+        <translation>English</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="105"/>
+        <source>字体大小:</source>
+        <translation>Font size:</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="121"/>
+        <source> pt</source>
+        <translation> pt</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="133"/>
+        <source>行为</source>
+        <translation>Behavior</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="139"/>
+        <source>启用自动保存</source>
+        <translation>Enable auto-save</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="149"/>
+        <source>自动保存间隔:</source>
+        <translation>Auto-save interval:</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="165"/>
+        <source> 分钟</source>
+        <translation> min</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="172"/>
+        <source>最小化到系统托盘</source>
+        <translation>Minimize to system tray</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="179"/>
+        <source>开机自动启动</source>
+        <translation>Start at login</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="200"/>
+        <source>就绪</source>
+        <translation>Ready</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="217"/>
+        <source>恢复所有设置为默认值</source>
+        <translation>Restore all settings to their defaults</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="234"/>
+        <source>放弃更改，恢复上次保存的设置</source>
+        <translation>Discard changes and restore the last saved settings</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="241"/>
+        <source>应用</source>
+        <translation>Apply</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/ui/PreferencesPage.ui" line="244"/>
+        <source>保存并应用所有设置</source>
+        <translation>Save and apply all settings</translation>
+    </message>
+</context>
+<context>
+    <name>QObject</name>
+    <message>
+        <location filename="../src/secondui/src/Expression.cpp" line="67"/>
+        <source>无法识别的字符: %1</source>
+        <translation>Unrecognized character: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/Expression.cpp" line="77"/>
+        <source>表达式不完整</source>
+        <translation>Incomplete expression</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/Expression.cpp" line="182"/>
+        <source>无效的数字: %1</source>
+        <translation>Invalid number: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/Expression.cpp" line="210"/>
+        <source>函数 %1 后缺少括号</source>
+        <translation>Missing parenthesis after function %1</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/Expression.cpp" line="219"/>
+        <source>未知的名称: %1</source>
+        <translation>Unknown name: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/Expression.cpp" line="228"/>
+        <source>缺少右括号</source>
+        <translation>Missing closing parenthesis</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="55"/>
+        <source>第 %1 行包含无法识别的内容: %2</source>
+        <translation>Line %1 contains unrecognized content: %2</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="64"/>
+        <source>第 %1 行有 %2 个数，应为 %3 个</source>
+        <translation>Line %1 has %2 numbers, expected %3</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="72"/>
+        <source>矩阵为空</source>
+        <translation>The matrix is empty</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="86"/>
+        <source>%1 × %2 矩阵
+</source>
+        <translation>%1 × %2 matrix
+</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="105"/>
+        <source>没有可统计的数字</source>
+        <translation>No numbers to analyze</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="108"/>
+        <source>数量:     %1
+</source>
+        <translation>Count:    %1
+</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="109"/>
+        <source>总和:     %1
+</source>
+        <translation>Sum:      %1
+</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="110"/>
+        <source>均值:     %1
+</source>
+        <translation>Mean:     %1
+</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="111"/>
+        <source>样本方差: %1
+</source>
+        <translation>Variance: %1
+</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="112"/>
+        <source>标准差:   %1
+</source>
+        <translation>Std dev:  %1
+</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="113"/>
+        <source>最小值:   %1
+</source>
+        <translation>Minimum:  %1
+</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="114"/>
+        <source>Q1:       %1
+</source>
+        <translation>Q1:       %1
+</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="115"/>
+        <source>中位数:   %1
+</source>
+        <translation>Median:   %1
+</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="116"/>
+        <source>Q3:       %1
+</source>
+        <translation>Q3:       %1
+</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="117"/>
+        <source>P95:      %1
+</source>
+        <translation>P95:      %1
+</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="118"/>
+        <source>最大值:   %1
+</source>
+        <translation>Maximum:  %1
+</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="119"/>
+        <source>
+分位数为单遍P²估计值</source>
+        <translation>
+Quantiles are single-pass P² estimates</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="121"/>
+        <source>
+已跳过 %1 个无法识别的片段</source>
+        <translation>
+Skipped %1 unrecognized fragments</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/src/MatrixStatsDialog.cpp" line="127"/>
+        <source>%1 ms</source>
+        <translation>%1 ms</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/src/TranslationManager.cpp" line="58"/>
+        <source>无法加载翻译文件: %1</source>
+        <translation>Cannot load translation file: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/src/TranslationManager.cpp" line="76"/>
+        <source>不支持的语言</source>
+        <translation>Unsupported language</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="245"/>
+        <source>%1 个目标名称与其他项重复，未做任何改动: %2%3</source>
+        <translation>%1 target names duplicate other items; nothing was changed: %2%3</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="330"/>
+        <source>上次的批量重命名没有正常结束，请先恢复或丢弃它的记录</source>
+        <translation>The last batch rename did not finish; restore or discard its record first</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="337"/>
+        <source>无法写入恢复日志: %1</source>
+        <translation>Cannot write the recovery log: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="346"/>
+        <source>无法重命名 %1: %2</source>
+        <translation>Cannot rename %1: %2</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="355"/>
+        <source>无法更新恢复日志: %1</source>
+        <translation>Cannot update the recovery log: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/BatchRenamer.cpp" line="419"/>
+        <source>正则表达式无效: %1</source>
+        <translation>Invalid regular expression: %1</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/include/CalculatorPage.h" line="33"/>
+        <source>计算器</source>
+        <translation>Calculator</translation>
+    </message>
+    <message>
+        <location filename="../src/settings/include/PreferencesPage.h" line="28"/>
+        <source>首选项</source>
+        <translation>Preferences</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/include/FileManagerPage.h" line="43"/>
+        <source>文件管理</source>
+        <translation>Files</translation>
+    </message>
+</context>
+<context>
+    <name>QuickOpenDialog</name>
+    <message>
+        <location filename="../src/dashboard/src/QuickOpenDialog.cpp" line="51"/>
+        <source>快速打开 - %1</source>
+        <translation>Quick Open - %1</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/QuickOpenDialog.cpp" line="182"/>
+        <source>%1路径: %2 | 结果: %3 | 耗时: %4 ms</source>
+        <translation>%1Path: %2 | Results: %3 | Time: %4 ms</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/QuickOpenDialog.cpp" line="183"/>
+        <source>正在索引... </source>
+        <translation>Indexing... </translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/QuickOpenDialog.ui" line="14"/>
+        <source>快速打开</source>
+        <translation>Quick Open</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/QuickOpenDialog.ui" line="37"/>
+        <source>输入文件名片段进行模糊匹配...</source>
+        <translation>Type part of a file name for fuzzy matching...</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/ui/QuickOpenDialog.ui" line="55"/>
+        <source>就绪</source>
+        <translation>Ready</translation>
+    </message>
+</context>
+<context>
+    <name>RenamePreviewModel</name>
+    <message>
+        <location filename="../src/dashboard/src/RenamePreviewModel.cpp" line="122"/>
+        <source>%1    （不变）</source>
+        <translation>%1    (unchanged)</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/RenamePreviewModel.cpp" line="123"/>
+        <source>%1    →    %2</source>
+        <translation>%1    →    %2</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/RenamePreviewModel.cpp" line="131"/>
+        <source>新名称无效</source>
+        <translation>The new name is invalid</translation>
+    </message>
+    <message>
+        <location filename="../src/dashboard/src/RenamePreviewModel.cpp" line="133"/>
+        <source>与选中的其他项重名</source>
+        <translation>Duplicates the name of another selected item</translation>
+    </message>
+</context>
+<context>
+    <name>SecondWindow</name>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="26"/>
+        <source>计算器 - Second Window</source>
+        <translation>Calculator - Second Window</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="69"/>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="69"/>
+        <source>0</source>
+        <translation>0</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="129"/>
+        <source>绘制单变量函数曲线</source>
+        <translation>Plot a function of one variable</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="143"/>
+        <source>📈 绘图</source>
+        <translation>📈 Plot</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="156"/>
+        <source>矩阵运算与数据统计</source>
+        <translation>Matrix operations and data statistics</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="170"/>
+        <source>▦ 矩阵/统计</source>
+        <translation>▦ Matrix/Stats</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="202"/>
+        <source>C</source>
+        <translation>C</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="227"/>
+        <source>⌫</source>
+        <translation>⌫</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="252"/>
+        <source>%</source>
+        <translation>%</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="277"/>
+        <source>÷</source>
+        <translation>÷</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="305"/>
+        <source>7</source>
+        <translation>7</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="330"/>
+        <source>8</source>
+        <translation>8</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="355"/>
+        <source>9</source>
+        <translation>9</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="380"/>
+        <source>×</source>
+        <translation>×</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="408"/>
+        <source>4</source>
+        <translation>4</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="433"/>
+        <source>5</source>
+        <translation>5</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="458"/>
+        <source>6</source>
+        <translation>6</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="483"/>
+        <source>-</source>
+        <translation>-</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="511"/>
+        <source>1</source>
+        <translation>1</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="536"/>
+        <source>2</source>
+        <translation>2</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="561"/>
+        <source>3</source>
+        <translation>3</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="586"/>
+        <source>+</source>
+        <translation>+</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="614"/>
+        <source>±</source>
+        <translation>±</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="664"/>
+        <source>.</source>
+        <translation>.</translation>
+    </message>
+    <message>
+        <location filename="../src/secondui/ui/SecondWindow.ui" line="689"/>
+        <source>=</source>
+        <translation>=</translation>
+    </message>
+</context>
+<context>
+    <name>TreemapWidget</name>
+    <message>
+        <location filename="../src/dashboard/src/TreemapWidget.cpp" line="177"/>
+        <source>暂无数据</source>
+        <translation>No data</translation>
+    </message>
+</context>
+<context>
+    <name>mainui::MainWindow</name>
+    <message>
+        <location filename="../src/mainui/src/MainWindow.cpp" line="86"/>
+        <source>多页面示例 - Widget提升版</source>
+        <translation>Multi-Page Demo - Promoted Widgets</translation>
+    </message>
+    <message>
+        <location filename="../src/mainui/src/MainWindow.cpp" line="89"/>
+        <source>📁 文件管理</source>
+        <translation>📁 Files</translation>
+    </message>
+    <message>
+        <location filename="../src/mainui/src/MainWindow.cpp" line="90"/>
+        <source>⚙️ 首选项</source>
+        <translation>⚙️ Preferences</translation>
+    </message>
+    <message>
+        <location filename="../src/mainui/src/MainWindow.cpp" line="91"/>
+        <source>🧮 计算器</source>
+        <translation>🧮 Calculator</translation>
+    </message>
+</context>
+<context>
+    <name>mainui::SingleInstance</name>
+    <message>
+        <location filename="../src/mainui/src/SingleInstance.cpp" line="125"/>
+        <source>已有实例在运行</source>
+        <translation>An instance is already running</translation>
+    </message>
+</context>
+</TS>